@@ -1,4 +1,4 @@
-QT += core gui widgets
+QT += core gui widgets qml
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -11,12 +11,79 @@ SOURCES += \
     main.cpp \
     compileride.cpp \
     codeeditor.cpp \
-    syntaxhighlighter.cpp
+    syntaxhighlighter.cpp \
+    runstats.cpp \
+    outputviewer.cpp \
+    buildpipeline.cpp \
+    testpanel.cpp \
+    stresspanel.cpp \
+    plotwidget.cpp \
+    resourcemonitor.cpp \
+    benchmarkrunner.cpp \
+    scalingpanel.cpp \
+    complexitypanel.cpp \
+    autotunepanel.cpp \
+    pgopanel.cpp \
+    assemblyview.cpp \
+    optimizerremarks.cpp \
+    throughputpanel.cpp \
+    flamegraph.cpp \
+    profilerpanel.cpp \
+    coveragecollector.cpp \
+    symbolizer.cpp \
+    heappanel.cpp \
+    pythonprofilerpanel.cpp \
+    nodeprofilerpanel.cpp \
+    jsrunner.cpp \
+    pythonhost.cpp \
+    forkserver.cpp \
+    hotreload.cpp \
+    compileprofilepanel.cpp \
+    elffile.cpp \
+    binarysizepanel.cpp \
+    languagebackend.cpp
 
 HEADERS += \
     compileride.h \
     codeeditor.h \
-    syntaxhighlighter.h
+    syntaxhighlighter.h \
+    runstats.h \
+    outputviewer.h \
+    buildpipeline.h \
+    testpanel.h \
+    stresspanel.h \
+    plotwidget.h \
+    resourcemonitor.h \
+    benchmarkrunner.h \
+    scalingpanel.h \
+    complexitypanel.h \
+    autotunepanel.h \
+    pgopanel.h \
+    assemblyview.h \
+    optimizerremarks.h \
+    throughputpanel.h \
+    flamegraph.h \
+    profilerpanel.h \
+    coveragecollector.h \
+    symbolizer.h \
+    heappanel.h \
+    pythonprofilerpanel.h \
+    nodeprofilerpanel.h \
+    jsrunner.h \
+    pythonhost.h \
+    forkserver.h \
+    hotreload.h \
+    compileprofilepanel.h \
+    elffile.h \
+    binarysizepanel.h \
+    languagebackend.h
+
+# Warm Python run mode: qmake CONFIG+=embed_python
+embed_python {
+    DEFINES += CODEIDE_EMBED_PYTHON
+    QMAKE_CXXFLAGS += $$system(python3-config --includes)
+    LIBS += $$system(python3-config --embed --ldflags)
+}
 
 # Default rules for deployment
 qnx: target.path = /tmp/${TARGET}/bin
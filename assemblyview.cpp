@@ -0,0 +1,296 @@
+#include "assemblyview.h"
+#include "buildpipeline.h"
+#include <QCheckBox>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QPlainTextEdit>
+#include <QPushButton>
+#include <QRegularExpression>
+#include <QSet>
+#include <QTextBlock>
+#include <QTimer>
+#include <QVBoxLayout>
+
+AssemblyView::AssemblyView(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+
+    flagsEdit = new QLineEdit("-O2");
+    flagsEdit->setToolTip("Assembly üretirken kullanılacak derleyici bayrakları");
+    flagsEdit->setMaximumWidth(250);
+    connect(flagsEdit, &QLineEdit::returnPressed, this, &AssemblyView::refreshRequested);
+
+    intelCheck = new QCheckBox("Intel sözdizimi");
+    intelCheck->setStyleSheet("QCheckBox { color: #cccccc; }");
+    intelCheck->setChecked(true);
+    connect(intelCheck, &QCheckBox::toggled, this, &AssemblyView::refreshRequested);
+
+    liveCheck = new QCheckBox("Düzenlerken güncelle");
+    liveCheck->setStyleSheet("QCheckBox { color: #cccccc; }");
+    liveCheck->setChecked(true);
+
+    refreshButton = new QPushButton("⟳ Yenile");
+    connect(refreshButton, &QPushButton::clicked, this, &AssemblyView::refreshRequested);
+
+    statusLabel = new QLabel();
+    statusLabel->setStyleSheet("QLabel { color: #cccccc; }");
+
+    bar->addWidget(flagsEdit);
+    bar->addWidget(intelCheck);
+    bar->addWidget(liveCheck);
+    bar->addWidget(refreshButton);
+    bar->addStretch();
+    bar->addWidget(statusLabel);
+
+    asmEdit = new QPlainTextEdit();
+    asmEdit->setReadOnly(true);
+    asmEdit->setLineWrapMode(QPlainTextEdit::NoWrap);
+    asmEdit->setStyleSheet("QPlainTextEdit { background-color: #1e1e1e; color: #d4d4d4; "
+                           "border: none; }");
+    asmEdit->setFont(QFont("Consolas", 10));
+    connect(asmEdit, &QPlainTextEdit::cursorPositionChanged, this, &AssemblyView::onCursorMoved);
+
+    layout->addLayout(bar);
+    layout->addWidget(asmEdit);
+
+    editTimer = new QTimer(this);
+    editTimer->setSingleShot(true);
+    editTimer->setInterval(800);
+    connect(editTimer, &QTimer::timeout, this, &AssemblyView::refreshRequested);
+}
+
+void AssemblyView::sourceEdited() {
+    // Only worth compiling while someone is looking
+    if (liveCheck->isChecked() && isVisible())
+        editTimer->start();
+}
+
+void AssemblyView::refresh(BuildPipeline *pipeline, const QString &language, const QString &code) {
+    if (!BuildPipeline::isCompiled(language)) {
+        asmEdit->clear();
+        sourceLines.clear();
+        statusLabel->setText("Assembly yalnızca C ve C++ için üretilebilir");
+        emit mappingChanged();
+        return;
+    }
+
+    // One compile at a time; edits made meanwhile collapse into one rerun
+    if (busy) {
+        hasPending = true;
+        pendingPipeline = pipeline;
+        pendingLanguage = language;
+        pendingCode = code;
+        return;
+    }
+
+    // LTO would emit GIMPLE bytecode instead of assembly
+    QStringList flags;
+    for (const QString &flag : BuildPipeline::splitFlags(flagsEdit->text())) {
+        if (!flag.startsWith("-flto"))
+            flags << flag;
+    }
+    if (intelCheck->isChecked())
+        flags << "-masm=intel";
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(flags.join('\n').toUtf8());
+    QString key = BuildPipeline::sourceKey(language, code) +
+                  QString::fromLatin1(hash.result().toHex().left(8));
+    QString dir = QDir(pipeline->rootDir()).filePath("asm-" + key);
+    QString asmFile = dir + "/main.s";
+
+    QString sourceName = "main" + BuildPipeline::sourceSuffix(language);
+    if (QFileInfo::exists(asmFile)) {
+        load(asmFile, sourceName);
+        return;
+    }
+
+    QDir().mkpath(dir);
+    QString source = dir + "/" + sourceName;
+    QFile file(source);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        statusLabel->setText("Hata: Dosya oluşturulamadı!");
+        return;
+    }
+    file.write(code.toUtf8());
+    file.close();
+
+    busy = true;
+    statusLabel->setText("Derleniyor...");
+
+    QStringList arguments;
+    arguments << "-S" << "-g" << "-fno-asynchronous-unwind-tables" << source << flags << "-o" << asmFile;
+    pipeline->runStep(BuildPipeline::compiler(language), arguments,
+                      [this, asmFile, sourceName](bool ok, const QString &log) {
+        busy = false;
+        if (ok) {
+            load(asmFile, sourceName);
+        } else {
+            QFile::remove(asmFile);
+            statusLabel->setText("✗ Derleme hatası");
+            asmEdit->setPlainText(log);
+            sourceLines.clear();
+            emit mappingChanged();
+        }
+
+        if (hasPending) {
+            hasPending = false;
+            refresh(pendingPipeline, pendingLanguage, pendingCode);
+        }
+    });
+}
+
+QVector<AssemblyLine> AssemblyView::parseListing(const QString &path, const QString &sourceName, bool *ok,
+                                                 bool localLabels) {
+    QVector<AssemblyLine> result;
+    QFile file(path);
+    bool opened = file.open(QIODevice::ReadOnly | QIODevice::Text);
+    if (ok)
+        *ok = opened;
+    if (!opened)
+        return result;
+
+    // .file 1 "main.cpp"  or, with DWARF 5,  .file 1 "/dir" "main.cpp"
+    static const QRegularExpression fileRe(R"(^\s*\.file\s+(\d+)\s+"([^"]*)"(?:\s+"([^"]*)")?)");
+    static const QRegularExpression locRe(R"(^\s*\.loc\s+(\d+)\s+(\d+))");
+    static const QRegularExpression labelRe(R"(^([^\s:#]+):)");
+
+    QSet<int> mainFiles;
+    int current = 0;
+
+    while (!file.atEnd()) {
+        QString line = QString::fromUtf8(file.readLine()).trimmed();
+        if (line.isEmpty() || line.startsWith('#'))
+            continue;
+
+        if (line.startsWith('.')) {
+            QRegularExpressionMatch match = fileRe.match(line);
+            if (match.hasMatch()) {
+                QString name = match.captured(3).isEmpty() ? match.captured(2) : match.captured(3);
+                if (QFileInfo(name).fileName() == sourceName)
+                    mainFiles.insert(match.captured(1).toInt());
+                continue;
+            }
+            match = locRe.match(line);
+            if (match.hasMatch()) {
+                // Code inlined from headers has no line in the buffer
+                current = mainFiles.contains(match.captured(1).toInt()) ? match.captured(2).toInt() : 0;
+                continue;
+            }
+            // Local labels (.L...) and directives
+            match = labelRe.match(line);
+            if (localLabels && match.hasMatch()) {
+                AssemblyLine entry;
+                entry.text = match.captured(1) + ":";
+                entry.label = true;
+                result.append(entry);
+            }
+            continue;
+        }
+
+        AssemblyLine entry;
+        QRegularExpressionMatch label = labelRe.match(line);
+        if (label.hasMatch()) {
+            current = 0;
+            entry.text = label.captured(1) + ":";
+            entry.label = true;
+        } else {
+            entry.text = line.simplified();
+            entry.sourceLine = current;
+        }
+        result.append(entry);
+    }
+    return result;
+}
+
+void AssemblyView::load(const QString &path, const QString &sourceName) {
+    bool ok;
+    const QVector<AssemblyLine> listing = parseListing(path, sourceName, &ok);
+    if (!ok) {
+        statusLabel->setText("Hata: " + path + " okunamadı");
+        return;
+    }
+
+    QStringList lines;
+    sourceLines.clear();
+    for (const AssemblyLine &line : listing) {
+        lines << (line.label ? line.text : "    " + line.text);
+        sourceLines.append(line.sourceLine);
+    }
+
+    syncing = true;
+    asmEdit->setPlainText(lines.join('\n'));
+    syncing = false;
+    statusLabel->setText(QString("%1 komut").arg(lines.size()));
+    applyHighlights();
+    emit mappingChanged();
+}
+
+QColor AssemblyView::colorFor(int line, int alpha) {
+    static const QColor palette[] = {
+        QColor(86, 156, 214), QColor(206, 145, 120), QColor(78, 201, 176), QColor(220, 220, 170),
+        QColor(197, 134, 192), QColor(181, 206, 168), QColor(244, 135, 113), QColor(156, 220, 254)
+    };
+    QColor color = palette[line % 8];
+    color.setAlpha(alpha);
+    return color;
+}
+
+QHash<int, QColor> AssemblyView::sourceLineColors() const {
+    QHash<int, QColor> colors;
+    for (int line : sourceLines) {
+        if (line > 0)
+            colors.insert(line, colorFor(line, line == activeLine ? 110 : 45));
+    }
+    return colors;
+}
+
+void AssemblyView::applyHighlights() {
+    QList<QTextEdit::ExtraSelection> selections;
+    QTextBlock block = asmEdit->document()->firstBlock();
+    for (int i = 0; i < sourceLines.size() && block.isValid(); ++i, block = block.next()) {
+        if (sourceLines[i] == 0)
+            continue;
+        QTextEdit::ExtraSelection selection;
+        selection.format.setBackground(colorFor(sourceLines[i], sourceLines[i] == activeLine ? 110 : 45));
+        selection.format.setProperty(QTextFormat::FullWidthSelection, true);
+        selection.cursor = QTextCursor(block);
+        selections.append(selection);
+    }
+    asmEdit->setExtraSelections(selections);
+}
+
+void AssemblyView::showSourceLine(int line) {
+    if (line == activeLine)
+        return;
+    activeLine = line;
+    applyHighlights();
+
+    int index = sourceLines.indexOf(line);
+    if (index >= 0) {
+        syncing = true;
+        QTextCursor cursor(asmEdit->document()->findBlockByNumber(index));
+        asmEdit->setTextCursor(cursor);
+        asmEdit->centerCursor();
+        syncing = false;
+    }
+    emit mappingChanged();
+}
+
+void AssemblyView::onCursorMoved() {
+    if (syncing)
+        return;
+    int index = asmEdit->textCursor().blockNumber();
+    int line = sourceLines.value(index);
+    if (line > 0) {
+        showSourceLine(line);
+        emit sourceLineActivated(line);
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef ASSEMBLYVIEW_H
+#define ASSEMBLYVIEW_H
+
+#include <QWidget>
+#include <QColor>
+#include <QHash>
+#include <QVector>
+
+class BuildPipeline;
+class QCheckBox;
+class QLabel;
+class QLineEdit;
+class QPlainTextEdit;
+class QPushButton;
+class QTimer;
+
+// One line of a cleaned-up compiler listing
+struct AssemblyLine {
+    QString text;
+    int sourceLine = 0;     // 0 when it belongs to no line of the buffer
+    bool label = false;
+};
+
+// Generated assembly of the current buffer (-S -g), with directives and
+// local labels removed and every instruction tinted like its source line
+class AssemblyView : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit AssemblyView(QWidget *parent = nullptr);
+
+    void refresh(BuildPipeline *pipeline, const QString &language, const QString &code);
+    // Called on every edit, refreshes after a pause in typing
+    void sourceEdited();
+    QHash<int, QColor> sourceLineColors() const;
+    void showSourceLine(int line);
+
+    // Reads a -S -g listing, dropping directives and, unless asked to keep
+    // them for finding branch targets, local labels
+    static QVector<AssemblyLine> parseListing(const QString &path, const QString &sourceName,
+                                              bool *ok = nullptr, bool localLabels = false);
+
+signals:
+    void refreshRequested();
+    void mappingChanged();
+    void sourceLineActivated(int line);
+
+private slots:
+    void onCursorMoved();
+
+private:
+    void load(const QString &path, const QString &sourceName);
+    void applyHighlights();
+    static QColor colorFor(int line, int alpha);
+
+    QLineEdit *flagsEdit;
+    QCheckBox *intelCheck;
+    QCheckBox *liveCheck;
+    QPushButton *refreshButton;
+    QLabel *statusLabel;
+    QPlainTextEdit *asmEdit;
+    QTimer *editTimer;
+
+    QVector<int> sourceLines;
+    int activeLine = 0;
+    bool syncing = false;
+
+    bool busy = false;
+    bool hasPending = false;
+    BuildPipeline *pendingPipeline = nullptr;
+    QString pendingLanguage;
+    QString pendingCode;
+};
+
+#endif // ASSEMBLYVIEW_H
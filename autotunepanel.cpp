@@ -0,0 +1,344 @@
+#include "autotunepanel.h"
+#include "benchmarkrunner.h"
+#include <QCheckBox>
+#include <QFile>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPlainTextEdit>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QSplitter>
+#include <QTableWidget>
+#include <QVBoxLayout>
+#include <algorithm>
+#include <random>
+
+// Tag of the discarded warm-up run
+static const int warmupTag = -1;
+
+AutotunePanel::AutotunePanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+
+    fastMathCheck = new QCheckBox("-ffast-math dene");
+    fastMathCheck->setStyleSheet("QCheckBox { color: #cccccc; }");
+    fastMathCheck->setToolTip("Kayan nokta sonuçlarını değiştirebilir, çıktısı farklı olan "
+                              "varyantlar yine de elenir");
+
+    maxVariantsSpin = new QSpinBox();
+    maxVariantsSpin->setRange(2, 256);
+    maxVariantsSpin->setValue(16);
+    maxVariantsSpin->setPrefix("en fazla ");
+    maxVariantsSpin->setSuffix(" varyant");
+
+    repeatSpin = new QSpinBox();
+    repeatSpin->setRange(2, 50);
+    repeatSpin->setValue(5);
+    repeatSpin->setSuffix(" tekrar");
+
+    startButton = new QPushButton("▶ Bayrakları Ayarla");
+    connect(startButton, &QPushButton::clicked, this, [this]() {
+        if (!isRunning())
+            emit runRequested();
+    });
+    stopButton = new QPushButton("■ Durdur");
+    stopButton->setEnabled(false);
+    connect(stopButton, &QPushButton::clicked, this, &AutotunePanel::stop);
+
+    applyButton = new QPushButton("✓ Varsayılan Yap");
+    applyButton->setEnabled(false);
+    applyButton->setToolTip("En hızlı bayrakları F5 ile çalıştırmada kullan");
+    connect(applyButton, &QPushButton::clicked, this, [this]() {
+        emit applyRequested(language, bestFlags);
+    });
+
+    bar->addWidget(fastMathCheck);
+    bar->addWidget(maxVariantsSpin);
+    bar->addWidget(repeatSpin);
+    bar->addWidget(startButton);
+    bar->addWidget(stopButton);
+    bar->addWidget(applyButton);
+    bar->addStretch();
+
+    statusLabel = new QLabel("Hazır");
+    statusLabel->setStyleSheet("QLabel { color: #cccccc; }");
+
+    // One group per line, alternatives separated by "|", an empty
+    // alternative means the flag is left out
+    spaceEdit = new QPlainTextEdit();
+    spaceEdit->setPlainText("-O2 | -O3\n"
+                            " | -march=native\n"
+                            " | -funroll-loops\n"
+                            " | -flto\n"
+                            " | -fno-exceptions\n"
+                            " | -ffast-math\n");
+    spaceEdit->setToolTip("Her satır bir grup, seçenekler \"|\" ile ayrılır; ilk satırın ilk "
+                          "seçeneği temel alınır");
+    spaceEdit->setStyleSheet("QPlainTextEdit { background-color: #1e1e1e; color: #d4d4d4; "
+                             "border: none; border-right: 1px solid #454545; }");
+    spaceEdit->setFont(QFont("Consolas", 10));
+
+    table = new QTableWidget(0, 5);
+    table->setHorizontalHeaderLabels({"Bayraklar", "Medyan (ms)", "Ortalama ± %95 GA",
+                                      "Hızlanma", "Durum"});
+    table->horizontalHeader()->setStretchLastSection(true);
+    table->verticalHeader()->setVisible(false);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                         "gridline-color: #454545; border: none; }"
+                         "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                         "border: none; padding: 3px; }");
+
+    QSplitter *splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(spaceEdit);
+    splitter->addWidget(table);
+    splitter->setSizes({300, 800});
+
+    layout->addLayout(bar);
+    layout->addWidget(statusLabel);
+    layout->addWidget(splitter);
+
+    runner = new BenchmarkRunner(this);
+    connect(runner, &BenchmarkRunner::jobFinished, this, &AutotunePanel::onJobFinished);
+    connect(runner, &BenchmarkRunner::allFinished, this, &AutotunePanel::onAllFinished);
+    connect(runner, &BenchmarkRunner::progress, this, [this](int done, int total) {
+        statusLabel->setText(QString("Ölçülüyor: %1/%2").arg(done).arg(total));
+    });
+}
+
+bool AutotunePanel::isRunning() const {
+    return building || runner->isRunning();
+}
+
+void AutotunePanel::showError(const QString &message) {
+    statusLabel->setText(message);
+}
+
+void AutotunePanel::setRunning(bool running) {
+    startButton->setEnabled(!running);
+    stopButton->setEnabled(running);
+    spaceEdit->setReadOnly(running);
+}
+
+void AutotunePanel::stop() {
+    if (building) {
+        // Builds still in flight report into a stale generation and are ignored
+        ++generation;
+        building = false;
+        setRunning(false);
+        statusLabel->setText("Durduruldu");
+        return;
+    }
+    runner->cancel();
+}
+
+QString AutotunePanel::outputFile(int variant) const {
+    return runDir + QString("/variant-%1.out").arg(variant);
+}
+
+QVector<QStringList> AutotunePanel::searchSpace(const QString &language) const {
+    QVector<QStringList> combinations(1);
+    const QStringList lines = spaceEdit->toPlainText().split('\n');
+    for (const QString &line : lines) {
+        if (line.trimmed().isEmpty())
+            continue;
+
+        QStringList alternatives;
+        for (const QString &alternative : line.split('|')) {
+            QString flags = alternative.simplified();
+            if (flags.contains("-ffast-math") && !fastMathCheck->isChecked())
+                continue;
+            if (language == "C" && (flags.contains("-fno-exceptions") || flags.contains("-fno-rtti")))
+                continue;
+            if (!alternatives.contains(flags))
+                alternatives.append(flags);
+        }
+        if (alternatives.isEmpty())
+            continue;
+
+        QVector<QStringList> next;
+        for (const QStringList &combination : combinations) {
+            for (const QString &flags : alternatives)
+                next.append(combination + BuildPipeline::splitFlags(flags));
+        }
+        combinations = next;
+    }
+
+    // Past the limit keep the baseline and a random sample of the rest
+    int limit = maxVariantsSpin->value();
+    if (combinations.size() > limit) {
+        std::mt19937 random(std::random_device{}());
+        std::shuffle(combinations.begin() + 1, combinations.end(), random);
+        combinations.resize(limit);
+    }
+    return combinations;
+}
+
+void AutotunePanel::start(BuildPipeline *pipeline, const QString &language, const QString &code,
+                          const QString &inputFile, const QString &runDir) {
+    if (isRunning())
+        return;
+    if (!BuildPipeline::isCompiled(language)) {
+        showError("Hata: Otomatik ayar yalnızca C ve C++ için kullanılabilir!");
+        return;
+    }
+
+    this->language = language;
+    this->inputFile = inputFile;
+    this->runDir = runDir;
+    bestFlags.clear();
+    applyButton->setEnabled(false);
+    table->setRowCount(0);
+
+    variants.clear();
+    for (const QStringList &flags : searchSpace(language)) {
+        Variant variant;
+        variant.flags = flags;
+        variants.append(variant);
+    }
+
+    // Every variant builds at once, the pipeline keeps it to one compiler per core
+    int current = ++generation;
+    pendingBuilds = variants.size();
+    building = true;
+    setRunning(true);
+    statusLabel->setText(QString("%1 varyant derleniyor...").arg(variants.size()));
+
+    for (int i = 0; i < variants.size(); ++i) {
+        pipeline->build(language, code, variants[i].flags,
+                        [this, i, current](const RunTarget &target, const QString &log) {
+            Q_UNUSED(log);
+            if (current != generation)
+                return;
+            variants[i].target = target;
+            if (!target.isValid())
+                variants[i].status = "Derleme hatası";
+            if (--pendingBuilds == 0) {
+                building = false;
+                startBenchmarks();
+            }
+        });
+    }
+}
+
+void AutotunePanel::startBenchmarks() {
+    if (!variants.first().target.isValid()) {
+        setRunning(false);
+        statusLabel->setText("Hata: Temel varyant derlenemedi: " + variants.first().flags.join(' '));
+        return;
+    }
+
+    runner->reset(runDir);
+
+    BenchmarkJob warmup;
+    warmup.target = variants.first().target;
+    warmup.inputFile = inputFile;
+    warmup.tag = warmupTag;
+    runner->enqueue(warmup);
+
+    // Rounds interleave the variants so drift in machine state hits them all
+    // alike; the first round keeps each output for the correctness check
+    for (int round = 0; round < repeatSpin->value(); ++round) {
+        for (int i = 0; i < variants.size(); ++i) {
+            if (!variants[i].target.isValid())
+                continue;
+            BenchmarkJob job;
+            job.target = variants[i].target;
+            job.inputFile = inputFile;
+            if (round == 0)
+                job.outputFile = outputFile(i);
+            job.tag = i;
+            runner->enqueue(job);
+        }
+    }
+    runner->start();
+}
+
+void AutotunePanel::onJobFinished(int index, const RunStats &stats) {
+    int variant = runner->job(index).tag;
+    if (variant == warmupTag)
+        return;
+    if (!stats.valid || stats.exitCode != 0 || stats.signal != 0) {
+        variants[variant].status = "Çalışma hatası";
+        return;
+    }
+    variants[variant].times.append(stats.wallMs);
+}
+
+void AutotunePanel::onAllFinished() {
+    setRunning(false);
+
+    QFile baselineFile(outputFile(0));
+    QByteArray baseline = baselineFile.open(QIODevice::ReadOnly) ? baselineFile.readAll() : QByteArray();
+    for (int i = 1; i < variants.size(); ++i) {
+        if (!variants[i].status.isEmpty() || variants[i].times.isEmpty())
+            continue;
+        QFile file(outputFile(i));
+        if (!file.open(QIODevice::ReadOnly) || file.readAll() != baseline)
+            variants[i].status = "Çıktı farklı";
+    }
+
+    QVector<int> order;
+    for (int i = 0; i < variants.size(); ++i)
+        order.append(i);
+    std::sort(order.begin(), order.end(), [this](int a, int b) {
+        const Variant &x = variants[a], &y = variants[b];
+        bool xOk = x.status.isEmpty() && !x.times.isEmpty();
+        bool yOk = y.status.isEmpty() && !y.times.isEmpty();
+        if (xOk != yOk)
+            return xOk;
+        return xOk && BenchmarkRunner::median(x.times) < BenchmarkRunner::median(y.times);
+    });
+
+    double baselineMedian = variants.first().times.isEmpty()
+                                ? 0 : BenchmarkRunner::median(variants.first().times);
+
+    table->setRowCount(variants.size());
+    for (int row = 0; row < order.size(); ++row) {
+        const Variant &variant = variants[order[row]];
+        QString flags = variant.flags.join(' ');
+        if (order[row] == 0)
+            flags += " (temel)";
+
+        QStringList values;
+        values << flags;
+        if (variant.times.isEmpty()) {
+            values << "-" << "-" << "-";
+        } else {
+            double median = BenchmarkRunner::median(variant.times);
+            values << QString::number(median, 'f', 2)
+                   << QString("%1 ± %2").arg(BenchmarkRunner::mean(variant.times), 0, 'f', 2)
+                                        .arg(BenchmarkRunner::confidence95(variant.times), 0, 'f', 2)
+                   << (median > 0 ? QString::number(baselineMedian / median, 'f', 2) + "x" : "-");
+        }
+        values << (variant.status.isEmpty() ? "Tamam" : variant.status);
+        for (int column = 0; column < values.size(); ++column)
+            table->setItem(row, column, new QTableWidgetItem(values[column]));
+    }
+
+    const Variant &best = variants[order.first()];
+    if (!best.status.isEmpty() || best.times.isEmpty()) {
+        statusLabel->setText("Hata: Ölçülebilen varyant yok");
+        return;
+    }
+
+    bestFlags = best.flags;
+    applyButton->setEnabled(true);
+
+    // Overlapping intervals mean the ranking may just be noise
+    const Variant &base = variants.first();
+    double bestMean = BenchmarkRunner::mean(best.times);
+    double baseMean = BenchmarkRunner::mean(base.times);
+    bool significant = &best != &base &&
+        bestMean + BenchmarkRunner::confidence95(best.times) <
+        baseMean - BenchmarkRunner::confidence95(base.times);
+
+    statusLabel->setText(QString("En hızlı: %1 | temele göre %2x%3")
+                             .arg(bestFlags.join(' '))
+                             .arg(BenchmarkRunner::median(best.times) > 0
+                                      ? baselineMedian / BenchmarkRunner::median(best.times) : 0, 0, 'f', 2)
+                             .arg(significant ? "" : " (güven aralıkları çakışıyor, fark anlamlı değil)"));
+}
@@ -0,0 +1,73 @@
+#ifndef AUTOTUNEPANEL_H
+#define AUTOTUNEPANEL_H
+
+#include <QWidget>
+#include <QVector>
+#include "buildpipeline.h"
+#include "runstats.h"
+
+class BenchmarkRunner;
+class QCheckBox;
+class QLabel;
+class QPlainTextEdit;
+class QPushButton;
+class QSpinBox;
+class QTableWidget;
+
+// Searches a space of compiler flags: every combination is built in
+// parallel, then benchmarked in interleaved rounds on the same input
+class AutotunePanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit AutotunePanel(QWidget *parent = nullptr);
+
+    void start(BuildPipeline *pipeline, const QString &language, const QString &code,
+               const QString &inputFile, const QString &runDir);
+    void showError(const QString &message);
+    bool isRunning() const;
+
+signals:
+    void runRequested();
+    void applyRequested(const QString &language, const QStringList &flags);
+
+private slots:
+    void onJobFinished(int index, const RunStats &stats);
+    void onAllFinished();
+    void stop();
+
+private:
+    struct Variant {
+        QStringList flags;
+        RunTarget target;
+        QString status;
+        QVector<double> times;
+    };
+
+    QVector<QStringList> searchSpace(const QString &language) const;
+    void startBenchmarks();
+    void setRunning(bool running);
+    QString outputFile(int variant) const;
+
+    QPlainTextEdit *spaceEdit;
+    QCheckBox *fastMathCheck;
+    QSpinBox *repeatSpin;
+    QSpinBox *maxVariantsSpin;
+    QPushButton *startButton;
+    QPushButton *stopButton;
+    QPushButton *applyButton;
+    QLabel *statusLabel;
+    QTableWidget *table;
+
+    BenchmarkRunner *runner;
+    QVector<Variant> variants;
+    QString language;
+    QString inputFile;
+    QString runDir;
+    QStringList bestFlags;
+    int pendingBuilds = 0;
+    int generation = 0;
+    bool building = false;
+};
+
+#endif // AUTOTUNEPANEL_H
@@ -0,0 +1,135 @@
+#include "benchmarkrunner.h"
+#include <QDir>
+#include <QTimer>
+#include <algorithm>
+#include <cmath>
+
+BenchmarkRunner::BenchmarkRunner(QObject *parent) : QObject(parent) {
+}
+
+void BenchmarkRunner::reset(const QString &workDir) {
+    cancel();
+    dir = workDir;
+    jobs.clear();
+    next = 0;
+}
+
+void BenchmarkRunner::enqueue(const BenchmarkJob &job) {
+    jobs.append(job);
+}
+
+void BenchmarkRunner::start() {
+    if (running)
+        return;
+    QDir().mkpath(dir);
+    running = true;
+    next = 0;
+    runNext();
+}
+
+void BenchmarkRunner::cancel() {
+    if (!running)
+        return;
+    running = false;
+    if (current)
+        current->kill();
+    emit allFinished();
+}
+
+void BenchmarkRunner::runNext() {
+    if (!running)
+        return;
+    if (next >= jobs.size()) {
+        running = false;
+        emit allFinished();
+        return;
+    }
+
+    int index = next++;
+    const BenchmarkJob &job = jobs[index];
+    QString statsFile = QDir(dir).filePath(QString("bench-%1.stats").arg(index));
+
+    QProcess *process = new QProcess(this);
+    current = process;
+    if (!job.environment.isEmpty())
+        process->setProcessEnvironment(job.environment);
+    process->setStandardInputFile(job.inputFile.isEmpty() ? QProcess::nullDevice() : job.inputFile);
+    process->setStandardOutputFile(job.outputFile.isEmpty() ? QProcess::nullDevice() : job.outputFile);
+    process->setStandardErrorFile(QProcess::nullDevice());
+
+    QTimer *timeout = new QTimer(process);
+    timeout->setSingleShot(true);
+    connect(timeout, &QTimer::timeout, process, &QProcess::kill);
+
+    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            [this, process, index, statsFile]() {
+        process->deleteLater();
+        if (!running)
+            return;
+        emit jobFinished(index, RunStats::load(statsFile));
+        // A listener that cancels on a failed job keeps its error on screen
+        if (!running)
+            return;
+        emit progress(index + 1, jobs.size());
+        runNext();
+    });
+    connect(process, &QProcess::errorOccurred, [this, process, index](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart)
+            return;
+        process->deleteLater();
+        if (!running)
+            return;
+        emit jobFinished(index, RunStats());
+        if (!running)
+            return;
+        emit progress(index + 1, jobs.size());
+        runNext();
+    });
+
+    QString program = job.target.program;
+    QStringList arguments = job.target.arguments + job.arguments;
+    MeasuredRun::wrap(program, arguments, statsFile);
+    process->start(program, arguments);
+    timeout->start(timeoutMs);
+}
+
+double BenchmarkRunner::median(QVector<double> values) {
+    if (values.isEmpty())
+        return 0;
+    std::sort(values.begin(), values.end());
+    int middle = values.size() / 2;
+    if (values.size() % 2)
+        return values[middle];
+    return (values[middle - 1] + values[middle]) / 2;
+}
+
+double BenchmarkRunner::mean(const QVector<double> &values) {
+    if (values.isEmpty())
+        return 0;
+    double sum = 0;
+    for (double value : values)
+        sum += value;
+    return sum / values.size();
+}
+
+double BenchmarkRunner::stddev(const QVector<double> &values) {
+    if (values.size() < 2)
+        return 0;
+    double average = mean(values);
+    double sum = 0;
+    for (double value : values)
+        sum += (value - average) * (value - average);
+    return std::sqrt(sum / (values.size() - 1));
+}
+
+double BenchmarkRunner::confidence95(const QVector<double> &values) {
+    // Two-sided Student t critical values for 1..30 degrees of freedom
+    static const double t[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                               2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                               2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    int n = values.size();
+    if (n < 2)
+        return 0;
+    double critical = n - 1 <= 30 ? t[n - 2] : 1.96;
+    return critical * stddev(values) / std::sqrt(double(n));
+}
@@ -0,0 +1,58 @@
+#ifndef BENCHMARKRUNNER_H
+#define BENCHMARKRUNNER_H
+
+#include <QObject>
+#include <QPointer>
+#include <QProcess>
+#include <QProcessEnvironment>
+#include <QVector>
+#include "buildpipeline.h"
+#include "runstats.h"
+
+struct BenchmarkJob {
+    RunTarget target;
+    QStringList arguments;
+    QProcessEnvironment environment;
+    QString inputFile;
+    QString outputFile;
+    int tag = 0;
+};
+
+// Runs benchmark jobs strictly one after another, so measurements never
+// compete for cores. Every job goes through the measuring wrapper.
+class BenchmarkRunner : public QObject {
+    Q_OBJECT
+
+public:
+    explicit BenchmarkRunner(QObject *parent = nullptr);
+
+    void reset(const QString &workDir);
+    void enqueue(const BenchmarkJob &job);
+    void start();
+    void cancel();
+    bool isRunning() const { return running; }
+    const BenchmarkJob &job(int index) const { return jobs[index]; }
+    int jobTimeoutMs() const { return timeoutMs; }
+
+    static double median(QVector<double> values);
+    static double mean(const QVector<double> &values);
+    static double stddev(const QVector<double> &values);
+    static double confidence95(const QVector<double> &values);
+
+signals:
+    void jobFinished(int index, const RunStats &stats);
+    void progress(int done, int total);
+    void allFinished();
+
+private:
+    void runNext();
+
+    QString dir;
+    QVector<BenchmarkJob> jobs;
+    int next = 0;
+    bool running = false;
+    QPointer<QProcess> current;
+    int timeoutMs = 60000;
+};
+
+#endif // BENCHMARKRUNNER_H
@@ -0,0 +1,541 @@
+#include "binarysizepanel.h"
+#include "benchmarkrunner.h"
+#include <QDir>
+#include <QFile>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QProcess>
+#include <QPushButton>
+#include <QRegularExpression>
+#include <QSplitter>
+#include <QTabWidget>
+#include <QTableWidget>
+#include <QTimer>
+#include <QVBoxLayout>
+#include <algorithm>
+#include <memory>
+
+static const int maxRows = 200;
+static const int startupRuns = 5;
+static const int loaderTimeoutMs = 10000;
+
+static const char *variantNames[][2] = {
+    {"Dinamik", ""},
+    {"Dinamik, soyulmuş", "-s"},
+    {"Statik", "-static"},
+    {"Statik, soyulmuş", "-static -s"},
+};
+
+static QTableWidget *createTable(const QStringList &headers, int stretchColumn) {
+    QTableWidget *table = new QTableWidget(0, headers.size());
+    table->setHorizontalHeaderLabels(headers);
+    table->horizontalHeader()->setSectionResizeMode(stretchColumn, QHeaderView::Stretch);
+    table->verticalHeader()->setVisible(false);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                         "gridline-color: #454545; border: none; }"
+                         "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                         "border: none; padding: 3px; }");
+    return table;
+}
+
+static QTableWidgetItem *numberItem(double value) {
+    QTableWidgetItem *item = new QTableWidgetItem();
+    item->setData(Qt::DisplayRole, value);
+    return item;
+}
+
+static double kilobytes(quint64 bytes) {
+    return qRound64(bytes / 102.4) / 10.0;
+}
+
+// "std::vector<int, std::allocator<int> >::push_back(int const&)" becomes
+// "std::vector<…>::push_back", so every instantiation of one template lands
+// in the same group. Names without template arguments give an empty key.
+static QString templateKey(const QString &name) {
+    static const QString anonymous = "(anonymous namespace)";
+    QString key;
+    int depth = 0;
+    bool templated = false;
+    for (int i = 0; i < name.size(); ++i) {
+        QChar c = name[i];
+        if (depth == 0 && QStringView(name).mid(i).startsWith(anonymous)) {
+            key += anonymous;
+            i += anonymous.size() - 1;
+            continue;
+        }
+        // operator<, operator<< and operator() are names, not argument lists
+        if (depth == 0 && key.endsWith("operator")) {
+            if (QStringView(name).mid(i).startsWith("()")) {
+                key += "()";
+                ++i;
+                continue;
+            }
+            int length = 0;
+            while (length < 3 && i + length < name.size() && QString("<>=").contains(name[i + length]))
+                ++length;
+            if (length > 0) {
+                key += name.mid(i, length);
+                i += length - 1;
+                continue;
+            }
+        }
+        if (c == '<') {
+            if (depth++ == 0)
+                key += "<…>";
+            templated = true;
+        } else if (c == '>') {
+            depth = qMax(0, depth - 1);
+        } else if (depth == 0) {
+            if (c == '(')
+                break;
+            key += c;
+        }
+    }
+    return templated ? key.trimmed() : QString();
+}
+
+BinarySizePanel::BinarySizePanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+    startButton = new QPushButton("▶ Boyut ve Başlangıç Raporu");
+    connect(startButton, &QPushButton::clicked, this, [this]() {
+        if (!running)
+            emit runRequested();
+    });
+    stopButton = new QPushButton("■ Durdur");
+    stopButton->setEnabled(false);
+    connect(stopButton, &QPushButton::clicked, this, &BinarySizePanel::stop);
+    bar->addWidget(startButton);
+    bar->addWidget(stopButton);
+    bar->addStretch();
+
+    statusLabel = new QLabel("Hazır");
+    statusLabel->setStyleSheet("QLabel { color: #cccccc; }");
+    statusLabel->setWordWrap(true);
+    statusLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+
+    variantTable = createTable({"Varyant", "Dosya (KB)", "Kod (KB)", "Veri (KB)", "Başlatıcı",
+                                "Yer değiştirme", "Yükleyici (bin döngü)", "Boş girdiyle (ms)"}, 0);
+    variantTable->horizontalHeaderItem(6)->setToolTip("LD_DEBUG=statistics: dinamik yükleyicinin main()'den "
+                                                      "önce harcadığı süre; statik programda yükleyici yok");
+    variantTable->horizontalHeaderItem(7)->setToolTip(QString("Girdi olmadan %1 çalıştırmanın medyanı, "
+                                                              "süreç başlatma maliyetini gösterir")
+                                                          .arg(startupRuns));
+
+    sectionTable = createTable({"Bölüm", "Boyut (bayt)", "Pay %", "Tür"}, 0);
+    symbolTable = createTable({"Sembol", "Boyut (bayt)", "Tür", "Bölüm"}, 0);
+    templateTable = createTable({"Şablon", "Örnek", "Toplam (bayt)", "En büyük örnek"}, 3);
+    initializerTable = createTable({"Fonksiyon", "Boyut (bayt)", "Açıklama"}, 2);
+
+    detailTabs = new QTabWidget();
+    detailTabs->addTab(sectionTable, "Bölümler");
+    detailTabs->addTab(symbolTable, "Semboller");
+    detailTabs->addTab(templateTable, "Şablonlar");
+    detailTabs->addTab(initializerTable, "Başlatıcılar");
+
+    QSplitter *splitter = new QSplitter(Qt::Vertical);
+    splitter->addWidget(variantTable);
+    splitter->addWidget(detailTabs);
+    splitter->setSizes({150, 350});
+
+    layout->addLayout(bar);
+    layout->addWidget(statusLabel);
+    layout->addWidget(splitter);
+
+    runner = new BenchmarkRunner(this);
+    connect(runner, &BenchmarkRunner::jobFinished, this, [this](int index, const RunStats &stats) {
+        if (stats.valid)
+            variants[runner->job(index).tag].wallMs.append(stats.wallMs);
+    });
+    connect(runner, &BenchmarkRunner::progress, this, [this](int done, int total) {
+        statusLabel->setText(QString("Başlangıç süresi ölçülüyor: %1/%2").arg(done).arg(total));
+    });
+    connect(runner, &BenchmarkRunner::allFinished, this, [this]() {
+        if (!running)
+            return;
+        showVariants();
+        finish();
+    });
+}
+
+void BinarySizePanel::showError(const QString &message) {
+    statusLabel->setText(message);
+}
+
+void BinarySizePanel::fail(const QString &message) {
+    running = false;
+    startButton->setEnabled(true);
+    stopButton->setEnabled(false);
+    statusLabel->setText(message);
+}
+
+void BinarySizePanel::stop() {
+    if (!running)
+        return;
+    // Builds and steps already queued finish on their own, their results are ignored
+    ++generation;
+    fail("Durduruldu");
+    runner->cancel();
+}
+
+void BinarySizePanel::finish() {
+    running = false;
+    startButton->setEnabled(true);
+    stopButton->setEnabled(false);
+
+    const Variant &dynamic = variants[0];
+    QStringList summary;
+    summary << QString("Dinamik: %1 KB").arg(kilobytes(dynamic.elf.fileSize));
+    if (variants[2].elf.valid)
+        summary << QString("statik: %1 KB").arg(kilobytes(variants[2].elf.fileSize));
+    if (variants[1].elf.valid && dynamic.elf.fileSize > 0)
+        summary << QString("soyulunca %1% küçülüyor")
+                       .arg(qRound(100.0 * (dynamic.elf.fileSize - variants[1].elf.fileSize) / dynamic.elf.fileSize));
+    summary << QString("%1 statik başlatıcı").arg(dynamic.elf.initializers.size());
+    statusLabel->setText(summary.join(" | "));
+}
+
+void BinarySizePanel::start(BuildPipeline *buildPipeline, const QString &lang, const QString &source,
+                            const QStringList &flags) {
+    if (running)
+        return;
+
+    pipeline = buildPipeline;
+    language = lang;
+    code = source;
+    workDir = QDir(pipeline->rootDir()).filePath("binarysize-" + BuildPipeline::sourceKey(language, code));
+    QDir().mkpath(workDir);
+
+    variants.clear();
+    for (const auto &entry : variantNames) {
+        Variant variant;
+        variant.name = QString::fromUtf8(entry[0]);
+        variant.flags = flags + BuildPipeline::splitFlags(QString::fromLatin1(entry[1]));
+        variants.append(variant);
+    }
+
+    ++generation;
+    running = true;
+    startButton->setEnabled(false);
+    stopButton->setEnabled(true);
+    variantTable->setRowCount(0);
+    sectionTable->setRowCount(0);
+    symbolTable->setRowCount(0);
+    templateTable->setRowCount(0);
+    initializerTable->setRowCount(0);
+
+    buildVariants();
+}
+
+void BinarySizePanel::buildVariants() {
+    statusLabel->setText(QString("%1 varyant derleniyor...").arg(variants.size()));
+    int current = generation;
+    auto remaining = std::make_shared<int>(variants.size());
+    for (int i = 0; i < variants.size(); ++i) {
+        pipeline->build(language, code, variants[i].flags,
+                        [this, current, remaining, i](const RunTarget &target, const QString &log) {
+            if (current != generation)
+                return;
+            variants[i].target = target;
+            variants[i].log = log;
+            if (--*remaining == 0)
+                inspect();
+        });
+    }
+}
+
+void BinarySizePanel::inspect() {
+    if (!variants[0].target.isValid()) {
+        fail("✗ Derleme hatası:\n" + variants[0].log);
+        return;
+    }
+    for (Variant &variant : variants) {
+        if (variant.target.isValid())
+            variant.elf = ElfFile::load(variant.target.program);
+    }
+    if (!variants[0].elf.valid) {
+        fail("Hata: " + variants[0].elf.error);
+        return;
+    }
+    showVariants();
+    demangle();
+}
+
+void BinarySizePanel::demangle() {
+    // c++filt reads the names from a response file, a static binary has
+    // far too many of them for one command line
+    const ElfFile &elf = variants[0].elf;
+    QStringList names;
+    for (const ElfSymbol &symbol : elf.symbols) {
+        if (symbol.name.startsWith("_Z"))
+            names << symbol.name;
+        else if (symbol.name.startsWith("_GLOBAL__sub_I__Z"))
+            names << symbol.name.mid(15);
+    }
+    names.removeDuplicates();
+    if (names.isEmpty()) {
+        showDetails(QHash<QString, QString>());
+        measureLoader(0);
+        return;
+    }
+
+    QString listPath = QDir(workDir).filePath("symbols.txt");
+    QFile list(listPath);
+    if (!list.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        fail("Hata: Dosya oluşturulamadı!");
+        return;
+    }
+    list.write(names.join('\n').toUtf8());
+    list.close();
+
+    statusLabel->setText(QString("%1 sembol çözülüyor...").arg(names.size()));
+    int current = generation;
+    pipeline->runStep("c++filt", {"@" + listPath}, [this, current, names](bool ok, const QString &output) {
+        if (current != generation)
+            return;
+        QHash<QString, QString> demangled;
+        QStringList lines = output.split('\n');
+        if (ok && lines.size() >= names.size()) {
+            for (int i = 0; i < names.size(); ++i)
+                demangled.insert(names[i], lines[i]);
+        }
+        showDetails(demangled);
+        measureLoader(0);
+    });
+}
+
+void BinarySizePanel::measureLoader(int index) {
+    while (index < variants.size() && !(variants[index].elf.valid && variants[index].elf.dynamic))
+        ++index;
+    if (index >= variants.size()) {
+        measureStartup();
+        return;
+    }
+
+    statusLabel->setText(QString("Dinamik yükleyici ölçülüyor: %1").arg(variants[index].name));
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+    environment.insert("LD_DEBUG", "statistics");
+
+    QProcess *process = new QProcess(this);
+    process->setProcessEnvironment(environment);
+    process->setStandardInputFile(QProcess::nullDevice());
+    process->setStandardOutputFile(QProcess::nullDevice());
+
+    QTimer *timeout = new QTimer(process);
+    timeout->setSingleShot(true);
+    connect(timeout, &QTimer::timeout, process, &QProcess::kill);
+
+    int current = generation;
+    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            [this, process, current, index]() {
+        process->deleteLater();
+        if (current != generation)
+            return;
+        // The first statistics block is printed before main(), the second
+        // one at exit only adds the final relocation count
+        static const QRegularExpression cyclesRe(R"(total startup time in dynamic loader: (\d+) cycles)");
+        static const QRegularExpression relocationsRe(R"(\bnumber of relocations: (\d+))");
+        QString log = QString::fromLocal8Bit(process->readAllStandardError());
+        QRegularExpressionMatch cycles = cyclesRe.match(log);
+        QRegularExpressionMatch relocations = relocationsRe.match(log);
+        if (cycles.hasMatch())
+            variants[index].loaderCycles = cycles.captured(1).toLongLong();
+        if (relocations.hasMatch())
+            variants[index].relocations = relocations.captured(1).toLongLong();
+        measureLoader(index + 1);
+    });
+    connect(process, &QProcess::errorOccurred, [this, process, current, index](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart)
+            return;
+        process->deleteLater();
+        if (current == generation)
+            measureLoader(index + 1);
+    });
+
+    const RunTarget &target = variants[index].target;
+    process->start(target.program, target.arguments);
+    timeout->start(loaderTimeoutMs);
+}
+
+void BinarySizePanel::measureStartup() {
+    runner->reset(QDir(workDir).filePath("runs"));
+    for (int i = 0; i < variants.size(); ++i) {
+        if (!variants[i].elf.valid)
+            continue;
+        BenchmarkJob job;
+        job.target = variants[i].target;
+        job.tag = i;
+        for (int run = 0; run < startupRuns; ++run)
+            runner->enqueue(job);
+    }
+    runner->start();
+}
+
+void BinarySizePanel::showVariants() {
+    variantTable->setRowCount(variants.size());
+    for (int row = 0; row < variants.size(); ++row) {
+        const Variant &variant = variants[row];
+        QTableWidgetItem *name = new QTableWidgetItem(variant.name);
+        name->setToolTip(variant.flags.join(' '));
+        variantTable->setItem(row, 0, name);
+
+        if (!variant.elf.valid) {
+            QString reason = variant.target.isValid() ? variant.elf.error : variant.log.trimmed();
+            QTableWidgetItem *error = new QTableWidgetItem(variant.target.isValid() ? "okunamadı" : "derlenemedi");
+            error->setToolTip(reason);
+            variantTable->setItem(row, 1, error);
+            for (int column = 2; column < variantTable->columnCount(); ++column)
+                variantTable->setItem(row, column, new QTableWidgetItem("—"));
+            continue;
+        }
+
+        const ElfFile &elf = variant.elf;
+        variantTable->setItem(row, 1, numberItem(kilobytes(elf.fileSize)));
+        variantTable->setItem(row, 2, numberItem(kilobytes(elf.codeSize())));
+        variantTable->setItem(row, 3, numberItem(kilobytes(elf.dataSize())));
+        variantTable->setItem(row, 4, numberItem(elf.initializers.size()));
+        if (variant.relocations >= 0)
+            variantTable->setItem(row, 5, numberItem(variant.relocations));
+        else
+            variantTable->setItem(row, 5, new QTableWidgetItem("—"));
+        if (variant.loaderCycles >= 0)
+            variantTable->setItem(row, 6, numberItem(qRound64(variant.loaderCycles / 100.0) / 10.0));
+        else
+            variantTable->setItem(row, 6, new QTableWidgetItem(elf.dynamic ? "ölçülmedi" : "yok (statik)"));
+        if (!variant.wallMs.isEmpty())
+            variantTable->setItem(row, 7, numberItem(qRound64(BenchmarkRunner::median(variant.wallMs) * 100.0) / 100.0));
+        else
+            variantTable->setItem(row, 7, new QTableWidgetItem("—"));
+    }
+    variantTable->resizeColumnsToContents();
+}
+
+void BinarySizePanel::showDetails(const QHash<QString, QString> &names) {
+    const ElfFile &elf = variants[0].elf;
+
+    sectionTable->setSortingEnabled(false);
+    sectionTable->setRowCount(0);
+    for (const ElfSection &section : elf.sections) {
+        if (section.size == 0 || section.name.isEmpty())
+            continue;
+        QString kind;
+        if (!section.isAllocated())
+            kind = "Yalnızca dosyada (sembol, hata ayıklama)";
+        else if (!section.occupiesFile())
+            kind = "Yalnızca bellekte (sıfırla başlar)";
+        else if (section.isCode())
+            kind = "Kod";
+        else if (section.isWritable())
+            kind = "Veri";
+        else
+            kind = "Salt okunur";
+        double share = section.occupiesFile() && elf.fileSize > 0
+                           ? qRound64(1000.0 * section.size / elf.fileSize) / 10.0 : 0.0;
+
+        int row = sectionTable->rowCount();
+        sectionTable->insertRow(row);
+        sectionTable->setItem(row, 0, new QTableWidgetItem(section.name));
+        sectionTable->setItem(row, 1, numberItem(section.size));
+        sectionTable->setItem(row, 2, numberItem(share));
+        sectionTable->setItem(row, 3, new QTableWidgetItem(kind));
+    }
+    sectionTable->setSortingEnabled(true);
+    sectionTable->sortItems(1, Qt::DescendingOrder);
+
+    QVector<ElfSymbol> largest;
+    for (const ElfSymbol &symbol : elf.symbols) {
+        if (symbol.size > 0)
+            largest.append(symbol);
+    }
+    std::sort(largest.begin(), largest.end(), [](const ElfSymbol &a, const ElfSymbol &b) {
+        return a.size > b.size;
+    });
+    symbolTable->setSortingEnabled(false);
+    int rows = qMin(largest.size(), maxRows);
+    symbolTable->setRowCount(rows);
+    for (int row = 0; row < rows; ++row) {
+        const ElfSymbol &symbol = largest[row];
+        QTableWidgetItem *name = new QTableWidgetItem(names.value(symbol.name, symbol.name));
+        name->setToolTip(symbol.name);
+        symbolTable->setItem(row, 0, name);
+        symbolTable->setItem(row, 1, numberItem(symbol.size));
+        symbolTable->setItem(row, 2, new QTableWidgetItem(symbol.function ? "Fonksiyon" : "Nesne"));
+        symbolTable->setItem(row, 3, new QTableWidgetItem(symbol.section));
+    }
+    symbolTable->setSortingEnabled(true);
+    symbolTable->sortItems(1, Qt::DescendingOrder);
+
+    // Every instantiation is its own copy of the code; many copies of one
+    // template is where header-only libraries grow a binary
+    struct Group {
+        int count = 0;
+        quint64 total = 0;
+        quint64 largest = 0;
+        QString largestName;
+    };
+    QHash<QString, Group> groups;
+    for (const ElfSymbol &symbol : elf.symbols) {
+        if (!symbol.function || symbol.size == 0)
+            continue;
+        QString name = names.value(symbol.name, symbol.name);
+        QString key = templateKey(name);
+        if (key.isEmpty())
+            continue;
+        Group &group = groups[key];
+        ++group.count;
+        group.total += symbol.size;
+        if (symbol.size > group.largest) {
+            group.largest = symbol.size;
+            group.largestName = name;
+        }
+    }
+    QStringList keys = groups.keys();
+    std::sort(keys.begin(), keys.end(), [&groups](const QString &a, const QString &b) {
+        return groups[a].total > groups[b].total;
+    });
+    templateTable->setSortingEnabled(false);
+    rows = qMin(keys.size(), maxRows);
+    templateTable->setRowCount(rows);
+    for (int row = 0; row < rows; ++row) {
+        const Group &group = groups[keys[row]];
+        templateTable->setItem(row, 0, new QTableWidgetItem(keys[row]));
+        templateTable->setItem(row, 1, numberItem(group.count));
+        templateTable->setItem(row, 2, numberItem(group.total));
+        templateTable->setItem(row, 3, new QTableWidgetItem(group.largestName));
+    }
+    templateTable->setSortingEnabled(true);
+    templateTable->sortItems(2, Qt::DescendingOrder);
+
+    initializerTable->setRowCount(elf.initializers.size());
+    for (int row = 0; row < elf.initializers.size(); ++row) {
+        quint64 address = elf.initializers[row];
+        QString function = elf.functionAt(address);
+        quint64 size = 0;
+        for (const ElfSymbol &symbol : elf.symbols) {
+            if (symbol.function && symbol.address == address)
+                size = symbol.size;
+        }
+
+        QString description;
+        if (function.isEmpty()) {
+            function = QString("0x%1").arg(address, 0, 16);
+            description = elf.stripped ? "Sembol yok (soyulmuş)" : "Bilinmiyor";
+        } else if (function == "frame_dummy") {
+            description = "C çalışma zamanı, her programda bulunur";
+        } else if (function.startsWith("_GLOBAL__sub_I_")) {
+            QString keyedTo = function.mid(15);
+            description = "Global nesnelerin kurucuları, ilki: " + names.value(keyedTo, keyedTo);
+        } else {
+            description = "__attribute__((constructor)) veya kütüphane başlatıcısı";
+            function = names.value(function, function);
+        }
+        initializerTable->setItem(row, 0, new QTableWidgetItem(function));
+        initializerTable->setItem(row, 1, numberItem(size));
+        initializerTable->setItem(row, 2, new QTableWidgetItem(description));
+    }
+}
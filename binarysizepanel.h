@@ -0,0 +1,79 @@
+#ifndef BINARYSIZEPANEL_H
+#define BINARYSIZEPANEL_H
+
+#include <QWidget>
+#include <QHash>
+#include <QVector>
+#include "buildpipeline.h"
+#include "elffile.h"
+
+class BenchmarkRunner;
+class QLabel;
+class QPushButton;
+class QTabWidget;
+class QTableWidget;
+
+// What a compiled program is made of and what it costs to start. The code
+// is built four ways (dynamic/static, with/without symbols) and each ELF is
+// read for its sections, largest symbols, template instantiations and
+// static initializers. Startup is measured twice: the dynamic loader's own
+// LD_DEBUG=statistics report, and the wall time of runs with empty input.
+class BinarySizePanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit BinarySizePanel(QWidget *parent = nullptr);
+
+    void start(BuildPipeline *pipeline, const QString &language, const QString &code, const QStringList &flags);
+    void showError(const QString &message);
+    bool isRunning() const { return running; }
+
+signals:
+    void runRequested();
+
+private slots:
+    void stop();
+
+private:
+    struct Variant {
+        QString name;
+        QStringList flags;
+        RunTarget target;
+        QString log;
+        ElfFile elf;
+        qint64 loaderCycles = -1;
+        qint64 relocations = -1;
+        QVector<double> wallMs;
+    };
+
+    void buildVariants();
+    void inspect();
+    void demangle();
+    void measureLoader(int index);
+    void measureStartup();
+    void showVariants();
+    void showDetails(const QHash<QString, QString> &names);
+    void finish();
+    void fail(const QString &message);
+
+    QPushButton *startButton;
+    QPushButton *stopButton;
+    QLabel *statusLabel;
+    QTableWidget *variantTable;
+    QTabWidget *detailTabs;
+    QTableWidget *sectionTable;
+    QTableWidget *symbolTable;
+    QTableWidget *templateTable;
+    QTableWidget *initializerTable;
+    BenchmarkRunner *runner;
+
+    BuildPipeline *pipeline = nullptr;
+    bool running = false;
+    int generation = 0;
+    QString language;
+    QString code;
+    QString workDir;
+    QVector<Variant> variants;
+};
+
+#endif // BINARYSIZEPANEL_H
@@ -0,0 +1,272 @@
+#include "buildpipeline.h"
+#include "languagebackend.h"
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QProcess>
+#include <QStandardPaths>
+#include <QThread>
+
+BuildPipeline::BuildPipeline(const QString &rootDir, QObject *parent)
+    : QObject(parent), root(rootDir) {
+}
+
+bool BuildPipeline::isCompiled(const QString &language) {
+    const LanguageBackend *backend = LanguageBackend::find(language);
+    return backend && backend->isCompiled();
+}
+
+QString BuildPipeline::sourceSuffix(const QString &language) {
+    const LanguageBackend *backend = LanguageBackend::find(language);
+    return backend ? backend->sourceSuffix() : ".txt";
+}
+
+QString BuildPipeline::compiler(const QString &language) {
+    const LanguageBackend *backend = LanguageBackend::find(language);
+    return backend ? backend->defaultTool() : QString();
+}
+
+QStringList BuildPipeline::splitFlags(const QString &text) {
+    QString flags = text.simplified();
+    return flags.isEmpty() ? QStringList() : flags.split(' ');
+}
+
+void BuildPipeline::setInterpreter(const QString &language, const QString &program) {
+    if (program.isEmpty())
+        interpreters.remove(language);
+    else
+        interpreters.insert(language, program);
+}
+
+QString BuildPipeline::interpreter(const QString &language) const {
+    return interpreters.value(language, compiler(language));
+}
+
+QStringList BuildPipeline::availableInterpreters(const QString &language) {
+    const LanguageBackend *backend = LanguageBackend::find(language);
+    const QStringList candidates = backend ? backend->toolCandidates() : QStringList();
+
+    // python3 and python are often the same binary under two names
+    QStringList found;
+    QStringList seen;
+    for (const QString &candidate : candidates) {
+        QString path = QStandardPaths::findExecutable(candidate);
+        if (path.isEmpty())
+            continue;
+        QString real = QFileInfo(path).canonicalFilePath();
+        if (seen.contains(real))
+            continue;
+        seen << real;
+        found << candidate;
+    }
+    return found;
+}
+
+QStringList BuildPipeline::availableLinkers() {
+    // Fastest first
+    static const char *candidates[][2] = {{"mold", "mold"}, {"lld", "ld.lld"}, {"gold", "ld.gold"}};
+    static const QStringList found = []() {
+        QStringList names;
+        for (const auto &candidate : candidates) {
+            if (!QStandardPaths::findExecutable(QString::fromLatin1(candidate[1])).isEmpty())
+                names << QString::fromLatin1(candidate[0]);
+        }
+        return names;
+    }();
+    return found;
+}
+
+void BuildPipeline::setLinker(const QString &language, const QString &name) {
+    if (name.isEmpty())
+        linkers.remove(language);
+    else
+        linkers.insert(language, name);
+}
+
+QString BuildPipeline::linker(const QString &language) const {
+    QString preferred = linkers.value(language);
+    if (preferred == "bfd")
+        return QString();
+    if (!preferred.isEmpty())
+        return preferred;
+    for (const QString &name : availableLinkers()) {
+        if (!unusableLinkers.contains(name))
+            return name;
+    }
+    return QString();
+}
+
+void BuildPipeline::dropLinker(const QString &name) {
+    unusableLinkers.insert(name);
+}
+
+QString BuildPipeline::sourceKey(const QString &language, const QString &code) {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(language.toUtf8());
+    hash.addData(code.toUtf8());
+    return QString::fromLatin1(hash.result().toHex().left(16));
+}
+
+void BuildPipeline::build(const QString &language, const QString &code, const QStringList &flags,
+                          Callback done) {
+    const LanguageBackend *backend = LanguageBackend::find(language);
+    if (!backend) {
+        done(RunTarget(), "Hata: " + language + " desteklenmiyor!");
+        return;
+    }
+
+    // One copy of the source per revision, shared by every build of it
+    BuildRequest request;
+    request.code = code;
+    request.flags = flags;
+    request.source = QDir(root).filePath("source-" + sourceKey(language, code)) + "/main" + backend->sourceSuffix();
+    request.linker = linker(language);
+    request.automaticLinker = linkers.value(language).isEmpty();
+    request.splitDwarf = splitDwarf;
+
+    if (!backend->isCompiled()) {
+        if (!writeSource(request.source, code)) {
+            done(RunTarget(), "Hata: Dosya oluşturulamadı!");
+            return;
+        }
+        done(backend->runTarget(interpreter(language), request.source, QString()), QString());
+        return;
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(language.toUtf8());
+    hash.addData(flags.join('\n').toUtf8());
+    hash.addData(code.toUtf8());
+    hash.addData(backend->cacheKey(request));
+    QString key = QString::fromLatin1(hash.result().toHex().left(16));
+
+    QString dir = QDir(root).filePath("build-" + key);
+#ifdef Q_OS_WIN
+    request.program = dir + "/program.exe";
+#else
+    request.program = dir + "/program";
+#endif
+    RunTarget target = backend->runTarget(interpreter(language), request.source, request.program);
+
+    // Same build already running, just wait for it
+    if (pending.contains(key)) {
+        pending[key].append(done);
+        return;
+    }
+
+    if (QFileInfo::exists(request.program)) {
+        done(target, QString());
+        return;
+    }
+
+    QDir().mkpath(dir);
+    if (!writeSource(request.source, code)) {
+        done(RunTarget(), "Hata: Dosya oluşturulamadı!");
+        return;
+    }
+
+    pending[key].append(done);
+    backend->build(this, request, [this, key, target](bool ok, const QString &log) {
+        finish(key, ok ? target : RunTarget(), log);
+    });
+}
+
+void BuildPipeline::cachedStep(const QString &output, const QString &program, const QStringList &arguments,
+                               StepCallback done) {
+    if (pendingSteps.contains(output)) {
+        pendingSteps[output].append(done);
+        return;
+    }
+    if (QFileInfo::exists(output)) {
+        done(true, QString());
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(output).path());
+    pendingSteps[output].append(done);
+    runStep(program, arguments, [this, output](bool ok, const QString &log) {
+        if (!ok)
+            QFile::remove(output);
+        const QList<StepCallback> callbacks = pendingSteps.take(output);
+        for (const StepCallback &callback : callbacks)
+            callback(ok, log);
+    });
+}
+
+bool BuildPipeline::writeSource(const QString &path, const QString &code) {
+    if (QFileInfo::exists(path))
+        return true;
+    QDir().mkpath(QFileInfo(path).path());
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+        return false;
+    file.write(code.toUtf8());
+    return true;
+}
+
+void BuildPipeline::runStep(const QString &program, const QStringList &arguments, StepCallback done) {
+    queued.append([this, program, arguments, done]() {
+        QProcess *process = new QProcess(this);
+        process->setProcessChannelMode(QProcess::MergedChannels);
+        connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+                [this, process, done](int exitCode, QProcess::ExitStatus exitStatus) {
+            QString log = QString::fromLocal8Bit(process->readAll());
+            process->deleteLater();
+            --activeBuilds;
+            done(exitStatus == QProcess::NormalExit && exitCode == 0, log);
+            startQueued();
+        });
+        connect(process, &QProcess::errorOccurred, [this, process, program, done](QProcess::ProcessError error) {
+            if (error != QProcess::FailedToStart)
+                return;
+            process->deleteLater();
+            --activeBuilds;
+            done(false, "Hata: " + program + " başlatılamadı!");
+            startQueued();
+        });
+        process->start(program, arguments);
+    });
+    startQueued();
+}
+
+void BuildPipeline::buildPreload(const QString &name, const QByteArray &source, LibraryCallback done) {
+    QString key = QString::fromLatin1(QCryptographicHash::hash(source, QCryptographicHash::Sha1).toHex().left(16));
+    QString dir = QDir(root).filePath(name + "-" + key);
+    QString library = dir + "/libcodeide-" + name + ".so";
+    if (QFileInfo::exists(library)) {
+        done(library, QString());
+        return;
+    }
+
+    QDir().mkpath(dir);
+    QFile file(dir + "/" + name + ".c");
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        done(QString(), "Hata: Dosya oluşturulamadı!");
+        return;
+    }
+    file.write(source);
+    file.close();
+
+    runStep(compiler("C"), {"-shared", "-fPIC", "-O2", "-o", library, file.fileName(), "-ldl"},
+            [library, done](bool ok, const QString &log) {
+        if (!ok)
+            QFile::remove(library);
+        done(ok ? library : QString(), log);
+    });
+}
+
+void BuildPipeline::startQueued() {
+    // At most one compiler per core, the rest wait their turn
+    int limit = qMax(1, QThread::idealThreadCount());
+    while (activeBuilds < limit && !queued.isEmpty()) {
+        ++activeBuilds;
+        queued.takeFirst()();
+    }
+}
+
+void BuildPipeline::finish(const QString &key, const RunTarget &target, const QString &log) {
+    const QList<Callback> callbacks = pending.take(key);
+    for (const Callback &callback : callbacks)
+        callback(target, log);
+}
@@ -0,0 +1,86 @@
+#ifndef BUILDPIPELINE_H
+#define BUILDPIPELINE_H
+
+#include <QObject>
+#include <QHash>
+#include <QSet>
+#include <QStringList>
+#include <functional>
+
+// A ready-to-start program: the binary itself, or an interpreter plus script
+struct RunTarget {
+    QString program;
+    QStringList arguments;
+    QString buildDir;
+
+    bool isValid() const { return !program.isEmpty(); }
+};
+
+// Builds source code into a RunTarget. Every build lives in its own
+// directory keyed by a hash of language, flags and source, so rebuilding
+// unchanged code is free and several features can share one binary.
+// What a language needs beyond that (toolchain, build steps, how to run
+// the result) comes from its LanguageBackend.
+class BuildPipeline : public QObject {
+    Q_OBJECT
+
+public:
+    using Callback = std::function<void(const RunTarget &target, const QString &log)>;
+    using StepCallback = std::function<void(bool ok, const QString &log)>;
+    using LibraryCallback = std::function<void(const QString &library, const QString &log)>;
+
+    explicit BuildPipeline(const QString &rootDir, QObject *parent = nullptr);
+
+    void build(const QString &language, const QString &code, const QStringList &flags,
+               Callback done);
+    // Runs one toolchain command under the same one-per-core limit as builds
+    void runStep(const QString &program, const QStringList &arguments, StepCallback done);
+    // runStep for a command whose only product is output: skipped when the
+    // output exists, and concurrent requests for it share one run
+    void cachedStep(const QString &output, const QString &program, const QStringList &arguments,
+                    StepCallback done);
+    // Builds a bundled C helper into a shared library for LD_PRELOAD, once
+    // per session and source revision; library is empty on failure
+    void buildPreload(const QString &name, const QByteArray &source, LibraryCallback done);
+    QString rootDir() const { return root; }
+    // Interpreter used for scripts of the language instead of compiler()
+    void setInterpreter(const QString &language, const QString &program);
+    QString interpreter(const QString &language) const;
+
+    // Linker for a compiled language: empty picks the fastest one installed
+    // (mold, lld, gold), "bfd" keeps the compiler default
+    void setLinker(const QString &language, const QString &name);
+    QString linkerPreference(const QString &language) const { return linkers.value(language); }
+    QString linker(const QString &language) const;
+    // Leaves an automatically picked linker out for the rest of the session
+    void dropLinker(const QString &name);
+    // Debug builds keep their DWARF in .dwo files next to the object, so
+    // the linker never has to copy it
+    void setSplitDwarf(bool on) { splitDwarf = on; }
+    bool isSplitDwarf() const { return splitDwarf; }
+
+    static QString sourceKey(const QString &language, const QString &code);
+    static bool isCompiled(const QString &language);
+    static QString sourceSuffix(const QString &language);
+    static QString compiler(const QString &language);
+    static QStringList splitFlags(const QString &text);
+    static QStringList availableInterpreters(const QString &language);
+    static QStringList availableLinkers();
+
+private:
+    bool writeSource(const QString &path, const QString &code);
+    void finish(const QString &key, const RunTarget &target, const QString &log);
+    void startQueued();
+
+    QString root;
+    QHash<QString, QString> interpreters;
+    QHash<QString, QList<Callback>> pending;
+    QHash<QString, QList<StepCallback>> pendingSteps;
+    QHash<QString, QString> linkers;
+    QSet<QString> unusableLinkers;
+    bool splitDwarf = false;
+    QList<std::function<void()>> queued;
+    int activeBuilds = 0;
+};
+
+#endif // BUILDPIPELINE_H
@@ -1,12 +1,20 @@
 #include "codeeditor.h"
 #include <QPainter>
 #include <QTextBlock>
+#include <QHelpEvent>
+#include <QToolTip>
+#include <QMenu>
+#include <QContextMenuEvent>
+#include <cmath>
+#include <type_traits>
 
 CodeEditor::CodeEditor(QWidget *parent) : QPlainTextEdit(parent) {
     lineNumberArea = new LineNumberArea(this);
 
     connect(this, &CodeEditor::blockCountChanged, this, &CodeEditor::updateLineNumberAreaWidth);
     connect(this, &CodeEditor::updateRequest, this, &CodeEditor::updateLineNumberArea);
+    connect(document(), &QTextDocument::contentsChange, this, &CodeEditor::documentEdited);
+    lastRevision = document()->revision();
 
     updateLineNumberAreaWidth(0);
 
@@ -33,6 +41,28 @@ void CodeEditor::lineNumberAreaPaintEvent(QPaintEvent *event) {
             painter.setPen(QColor(128, 128, 128));
             painter.drawText(0, top, lineNumberArea->width() - 5, fontMetrics().height(),
                            Qt::AlignRight, number);
+
+            auto count = heat.counts.constFind(blockNumber + 1);
+            if (count != heat.counts.cend()) {
+                // Log scale, a handful of hot lines would wash out the rest otherwise
+                QColor color(60, 70, 90);
+                if (count.value() > 0) {
+                    double t = std::log1p(double(count.value())) / std::log1p(double(qMax<qint64>(1, maxHeat)));
+                    color = QColor::fromHsv(int(55 - 55 * t), 220, int(110 + 145 * t));
+                }
+                painter.fillRect(0, top, heatWidth() - 2, bottom - top, color);
+            }
+
+            int x = heatWidth() + 2;
+            for (const QHash<int, LineAnnotation> &markers : annotations) {
+                auto marker = markers.constFind(blockNumber + 1);
+                if (marker == markers.cend())
+                    continue;
+                painter.setPen(marker->color);
+                painter.drawText(x, top, fontMetrics().height(), fontMetrics().height(),
+                                 Qt::AlignCenter, marker->symbol);
+                x += fontMetrics().height();
+            }
         }
 
         block = block.next();
@@ -50,7 +80,132 @@ int CodeEditor::lineNumberAreaWidth() {
         ++digits;
     }
     int space = 10 + fontMetrics().horizontalAdvance(QLatin1Char('9')) * digits;
-    return space;
+    return space + heatWidth() + annotationWidth();
+}
+
+int CodeEditor::heatWidth() const {
+    return heat.counts.isEmpty() ? 0 : 6;
+}
+
+int CodeEditor::annotationWidth() const {
+    int columns = 0;
+    for (const QHash<int, LineAnnotation> &markers : annotations) {
+        if (!markers.isEmpty())
+            ++columns;
+    }
+    return columns * fontMetrics().height();
+}
+
+void CodeEditor::setAnnotations(const QString &source, const QHash<int, LineAnnotation> &markers) {
+    if (markers.isEmpty())
+        annotations.remove(source);
+    else
+        annotations[source] = markers;
+    updateGutter();
+}
+
+void CodeEditor::setLineHeat(const LineHeat &lineHeat) {
+    heat = lineHeat;
+    maxHeat = 0;
+    for (qint64 count : heat.counts)
+        maxHeat = qMax(maxHeat, count);
+    updateGutter();
+}
+
+void CodeEditor::updateGutter() {
+    updateLineNumberAreaWidth(0);
+    QRect cr = contentsRect();
+    lineNumberArea->setGeometry(QRect(cr.left(), cr.top(), lineNumberAreaWidth(), cr.height()));
+    lineNumberArea->update();
+}
+
+void CodeEditor::documentEdited(int position, int charsRemoved, int charsAdded) {
+    // The highlighter's format updates arrive here too but leave the revision alone
+    if (document()->revision() == lastRevision)
+        return;
+    lastRevision = document()->revision();
+    int delta = blockCount() - lastBlockCount;
+    lastBlockCount = blockCount();
+    if (annotations.isEmpty() && heat.counts.isEmpty())
+        return;
+
+    // Lines first..last now hold the edit, first..last - delta held it before
+    QTextBlock firstBlock = document()->findBlock(position);
+    int first = firstBlock.blockNumber() + 1;
+    int last = document()->findBlock(position + charsAdded).blockNumber() + 1;
+    // Whole lines inserted above or below a line leave that line intact
+    if (charsRemoved == 0 && delta > 0) {
+        if (position == firstBlock.position() + firstBlock.length() - 1)
+            ++first;
+        else if (position == firstBlock.position() &&
+                 document()->characterAt(position + charsAdded - 1) == QChar::ParagraphSeparator)
+            last = first + delta - 1;
+    }
+
+    auto remap = [first, last, delta](const auto &lines) {
+        typename std::decay<decltype(lines)>::type moved;
+        for (auto it = lines.cbegin(); it != lines.cend(); ++it) {
+            if (it.key() < first)
+                moved.insert(it.key(), it.value());
+            else if (it.key() > last - delta)
+                moved.insert(it.key() + delta, it.value());
+        }
+        return moved;
+    };
+
+    for (auto it = annotations.begin(); it != annotations.end();) {
+        it.value() = remap(it.value());
+        if (it.value().isEmpty())
+            it = annotations.erase(it);
+        else
+            ++it;
+    }
+    heat.counts = remap(heat.counts);
+    if (heat.counts.isEmpty())
+        maxHeat = 0;
+    updateGutter();
+}
+
+QString CodeEditor::lineNumberAreaToolTip(const QPoint &pos) {
+    QTextBlock block = cursorForPosition(QPoint(0, pos.y())).block();
+    QStringList tips;
+    auto count = heat.counts.constFind(block.blockNumber() + 1);
+    if (count != heat.counts.cend())
+        tips << QString("%1 %2").arg(count.value()).arg(heat.unit);
+    for (const QHash<int, LineAnnotation> &markers : annotations) {
+        auto marker = markers.constFind(block.blockNumber() + 1);
+        if (marker != markers.cend())
+            tips << marker->toolTip;
+    }
+    return tips.join("\n\n");
+}
+
+bool LineNumberArea::event(QEvent *event) {
+    if (event->type() == QEvent::ToolTip) {
+        QHelpEvent *help = static_cast<QHelpEvent *>(event);
+        QString text = codeEditor->lineNumberAreaToolTip(help->pos());
+        if (text.isEmpty())
+            QToolTip::hideText();
+        else
+            QToolTip::showText(help->globalPos(), text, this);
+        return true;
+    }
+    return QWidget::event(event);
+}
+
+void CodeEditor::setLineHighlights(const QHash<int, QColor> &colors) {
+    QList<QTextEdit::ExtraSelection> selections;
+    for (auto it = colors.cbegin(); it != colors.cend(); ++it) {
+        QTextBlock block = document()->findBlockByNumber(it.key() - 1);
+        if (!block.isValid())
+            continue;
+        QTextEdit::ExtraSelection selection;
+        selection.format.setBackground(it.value());
+        selection.format.setProperty(QTextFormat::FullWidthSelection, true);
+        selection.cursor = QTextCursor(block);
+        selections.append(selection);
+    }
+    setExtraSelections(selections);
 }
 
 void CodeEditor::resizeEvent(QResizeEvent *e) {
@@ -59,6 +214,16 @@ void CodeEditor::resizeEvent(QResizeEvent *e) {
     lineNumberArea->setGeometry(QRect(cr.left(), cr.top(), lineNumberAreaWidth(), cr.height()));
 }
 
+void CodeEditor::contextMenuEvent(QContextMenuEvent *event) {
+    QMenu *menu = createStandardContextMenu();
+    if (textCursor().hasSelection()) {
+        menu->addSeparator();
+        menu->addAction("Verimi Analiz Et (llvm-mca)", this, &CodeEditor::analyzeSelectionRequested);
+    }
+    menu->exec(event->globalPos());
+    delete menu;
+}
+
 void CodeEditor::updateLineNumberAreaWidth(int) {
     setViewportMargins(lineNumberAreaWidth(), 0, 0, 0);
 }
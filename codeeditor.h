@@ -3,9 +3,24 @@
 
 #include <QPlainTextEdit>
 #include <QWidget>
+#include <QHash>
+#include <QColor>
 
 class LineNumberArea;
 
+// A marker drawn in the gutter next to the line number
+struct LineAnnotation {
+    QString symbol;
+    QColor color;
+    QString toolTip;
+};
+
+// Per-line counts for the heat strip: profiler samples or coverage hits
+struct LineHeat {
+    QHash<int, qint64> counts;
+    QString unit;
+};
+
 class CodeEditor : public QPlainTextEdit {
     Q_OBJECT
 
@@ -14,16 +29,39 @@ public:
 
     void lineNumberAreaPaintEvent(QPaintEvent *event);
     int lineNumberAreaWidth();
+    // Background tint per source line (1-based), e.g. to link lines to assembly
+    void setLineHighlights(const QHash<int, QColor> &colors);
+    // Gutter markers per source line (1-based); each source (remarks,
+    // profiles...) owns its own set so they can be replaced independently
+    void setAnnotations(const QString &source, const QHash<int, LineAnnotation> &annotations);
+    // Heat strip at the left edge of the gutter; edited lines drop their
+    // counts while the rest follow the text as lines are inserted or removed
+    void setLineHeat(const LineHeat &heat);
+    QString lineNumberAreaToolTip(const QPoint &pos);
+
+signals:
+    void analyzeSelectionRequested();
 
 protected:
     void resizeEvent(QResizeEvent *event) override;
+    void contextMenuEvent(QContextMenuEvent *event) override;
 
 private slots:
     void updateLineNumberAreaWidth(int newBlockCount);
     void updateLineNumberArea(const QRect &rect, int dy);
+    void documentEdited(int position, int charsRemoved, int charsAdded);
 
 private:
+    int annotationWidth() const;
+    int heatWidth() const;
+    void updateGutter();
+
     LineNumberArea *lineNumberArea;
+    QHash<QString, QHash<int, LineAnnotation>> annotations;
+    LineHeat heat;
+    qint64 maxHeat = 0;
+    int lastBlockCount = 1;
+    int lastRevision = 0;
 };
 
 class LineNumberArea : public QWidget {
@@ -39,6 +77,8 @@ protected:
         codeEditor->lineNumberAreaPaintEvent(event);
     }
 
+    bool event(QEvent *event) override;
+
 private:
     CodeEditor *codeEditor;
 };
@@ -0,0 +1,551 @@
+#include "compileprofilepanel.h"
+#include "buildpipeline.h"
+#include <QCheckBox>
+#include <QComboBox>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLabel>
+#include <QPlainTextEdit>
+#include <QPushButton>
+#include <QRegularExpression>
+#include <QSplitter>
+#include <QStandardPaths>
+#include <QTableWidget>
+#include <QVBoxLayout>
+#include <algorithm>
+#include <memory>
+
+static const int maxRows = 300;
+
+// Standard headers a snippet most likely needs, guessed from the names it
+// uses; only offered when the result actually compiles
+static const char *headerHints[][2] = {
+    {"\\b(cin|cout|cerr|endl)\\b", "iostream"},
+    {"\\b(printf|scanf|puts|getchar|putchar|fopen)\\b", "cstdio"},
+    {"\\bvector\\s*<", "vector"},
+    {"\\b(string|to_string|getline|stoi|stoll)\\b", "string"},
+    {"\\b(multi)?map\\s*<", "map"},
+    {"\\bunordered_(multi)?map\\s*<", "unordered_map"},
+    {"\\b(multi)?set\\s*<", "set"},
+    {"\\bunordered_(multi)?set\\s*<", "unordered_set"},
+    {"\\b(queue|priority_queue)\\s*<", "queue"},
+    {"\\bstack\\s*<", "stack"},
+    {"\\bdeque\\s*<", "deque"},
+    {"\\blist\\s*<", "list"},
+    {"\\bbitset\\s*<", "bitset"},
+    {"\\barray\\s*<", "array"},
+    {"\\b(sort|stable_sort|reverse|min|max|min_element|max_element|lower_bound|upper_bound|unique|"
+     "next_permutation|fill|count|find|binary_search|swap)\\s*\\(", "algorithm"},
+    {"\\b(accumulate|iota|gcd|lcm|partial_sum)\\s*\\(", "numeric"},
+    {"\\b(sqrt|pow|abs|fabs|floor|ceil|log|log2|exp|sin|cos|atan2|hypot)\\s*\\(", "cmath"},
+    {"\\b(memset|memcpy|strlen|strcmp|strcpy)\\s*\\(", "cstring"},
+    {"\\b(setprecision|setw|fixed)\\b", "iomanip"},
+    {"\\b(stringstream|istringstream|ostringstream)\\b", "sstream"},
+    {"\\b(pair|make_pair)\\b", "utility"},
+    {"\\b(tuple|make_tuple|tie)\\b", "tuple"},
+    {"\\b(function|greater|less)\\s*<", "functional"},
+    {"\\b(INT_MAX|INT_MIN|LLONG_MAX|LLONG_MIN)\\b", "climits"},
+    {"\\bnumeric_limits\\b", "limits"},
+    {"\\b(u?int(8|16|32|64)_t)\\b", "cstdint"},
+    {"\\bchrono::", "chrono"},
+    {"\\b(mt19937|mt19937_64|uniform_int_distribution|random_device)\\b", "random"},
+    {"\\b(unique_ptr|shared_ptr|make_unique|make_shared)\\b", "memory"},
+    {"\\bassert\\s*\\(", "cassert"},
+    {"\\bstring_view\\b", "string_view"},
+    {"\\boptional\\s*<", "optional"},
+};
+
+CompileProfilePanel::CompileProfilePanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+
+    compilerCombo = new QComboBox();
+    compilerCombo->addItem("GCC");
+    if (!QStandardPaths::findExecutable("clang++").isEmpty())
+        compilerCombo->addItem("Clang");
+    compilerCombo->setToolTip("GCC: -ftime-report ve -H; Clang: -ftime-trace");
+
+    minimizeCheck = new QCheckBox("Include'ları sadeleştir");
+    minimizeCheck->setStyleSheet("QCheckBox { color: #cccccc; }");
+    minimizeCheck->setToolTip("Her #include satırını tek tek çıkarıp derleyerek gereksizleri bul");
+    minimizeCheck->setChecked(true);
+
+    startButton = new QPushButton("▶ Derlemeyi Profille");
+    connect(startButton, &QPushButton::clicked, this, [this]() {
+        if (!running)
+            emit runRequested();
+    });
+    stopButton = new QPushButton("■ Durdur");
+    stopButton->setEnabled(false);
+    connect(stopButton, &QPushButton::clicked, this, &CompileProfilePanel::stop);
+
+    bar->addWidget(compilerCombo);
+    bar->addWidget(minimizeCheck);
+    bar->addWidget(startButton);
+    bar->addWidget(stopButton);
+    bar->addStretch();
+
+    statusLabel = new QLabel("Hazır");
+    statusLabel->setStyleSheet("QLabel { color: #cccccc; }");
+    statusLabel->setWordWrap(true);
+    statusLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+
+    table = new QTableWidget(0, 5);
+    table->setHorizontalHeaderLabels({"Tür", "Ad", "Süre (ms)", "Pay %", "Ayrıntı"});
+    table->horizontalHeader()->setSectionResizeMode(1, QHeaderView::Stretch);
+    table->verticalHeader()->setVisible(false);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                         "gridline-color: #454545; border: none; }"
+                         "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                         "border: none; padding: 3px; }");
+
+    suggestionEdit = new QPlainTextEdit();
+    suggestionEdit->setReadOnly(true);
+    suggestionEdit->setLineWrapMode(QPlainTextEdit::NoWrap);
+    suggestionEdit->setStyleSheet("QPlainTextEdit { background-color: #1e1e1e; color: #d4d4d4; "
+                                  "border: none; }");
+    suggestionEdit->setFont(QFont("Consolas", 10));
+
+    QSplitter *splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(table);
+    splitter->addWidget(suggestionEdit);
+    splitter->setSizes({800, 350});
+
+    layout->addLayout(bar);
+    layout->addWidget(statusLabel);
+    layout->addWidget(splitter);
+}
+
+void CompileProfilePanel::showError(const QString &message) {
+    statusLabel->setText(message);
+}
+
+void CompileProfilePanel::fail(const QString &message) {
+    running = false;
+    startButton->setEnabled(true);
+    stopButton->setEnabled(false);
+    statusLabel->setText(message);
+}
+
+void CompileProfilePanel::stop() {
+    if (!running)
+        return;
+    // Compiler steps already queued finish on their own, their results are ignored
+    ++generation;
+    fail("Durduruldu");
+}
+
+void CompileProfilePanel::finish() {
+    running = false;
+    startButton->setEnabled(true);
+    stopButton->setEnabled(false);
+    statusLabel->setText(QString("%1 ile derleme: %2 ms")
+                             .arg(compilerCombo->currentText())
+                             .arg(totalMs, 0, 'f', 1));
+}
+
+QString CompileProfilePanel::compilerProgram() const {
+    if (compilerCombo->currentText() == "Clang")
+        return language == "C" ? "clang" : "clang++";
+    return BuildPipeline::compiler(language);
+}
+
+QString CompileProfilePanel::writeSource(const QString &name, const QString &text) const {
+    QString path = workDir + "/" + name + BuildPipeline::sourceSuffix(language);
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+        return QString();
+    file.write(text.toUtf8());
+    return path;
+}
+
+void CompileProfilePanel::start(BuildPipeline *buildPipeline, const QString &lang, const QString &source,
+                                const QStringList &compileFlags) {
+    if (running)
+        return;
+
+    pipeline = buildPipeline;
+    language = lang;
+    code = source;
+    flags = compileFlags;
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(compilerCombo->currentText().toUtf8());
+    hash.addData(flags.join('\n').toUtf8());
+    hash.addData(code.toUtf8());
+    QString key = QString::fromLatin1(hash.result().toHex().left(16));
+    workDir = QDir(pipeline->rootDir()).filePath("compileprofile-" + key);
+    QDir().mkpath(workDir);
+    sourcePath = writeSource("main", code);
+    if (sourcePath.isEmpty()) {
+        showError("Hata: Dosya oluşturulamadı!");
+        return;
+    }
+
+    ++generation;
+    running = true;
+    startButton->setEnabled(false);
+    stopButton->setEnabled(true);
+    table->setRowCount(0);
+    suggestionEdit->clear();
+    entries.clear();
+    totalMs = 0;
+
+    if (compilerCombo->currentText() == "Clang")
+        profileWithClang();
+    else
+        profileWithGcc();
+}
+
+void CompileProfilePanel::profileWithGcc() {
+    statusLabel->setText(compilerProgram() + " -ftime-report -H ile derleniyor...");
+    int current = generation;
+    QStringList arguments;
+    arguments << sourcePath << flags << "-ftime-report" << "-H" << "-c" << "-o" << workDir + "/main.o";
+    pipeline->runStep(compilerProgram(), arguments, [this, current](bool ok, const QString &log) {
+        if (current != generation)
+            return;
+        if (!ok) {
+            fail("✗ Derleme hatası:\n" + log);
+            return;
+        }
+        readGccReport(log);
+    });
+}
+
+static double gccTotalMs(const QString &report) {
+    //  TOTAL                              :   0.43          0.17          0.62           84M
+    static const QRegularExpression totalRe(R"(^\s*TOTAL\s*:\s*[\d.]+\s+[\d.]+\s+([\d.]+))",
+                                            QRegularExpression::MultilineOption);
+    QRegularExpressionMatch match = totalRe.match(report);
+    return match.hasMatch() ? match.captured(1).toDouble() * 1000.0 : 0;
+}
+
+void CompileProfilePanel::readGccReport(const QString &log) {
+    //  phase parsing                      :   0.38 ( 88%)   0.16 ( 94%)   0.56 ( 90%)    76M ( 91%)
+    static const QRegularExpression phaseRe(
+        R"(^\s*\|?([^:|]+?)\s*:\s*[\d.]+\s*\(\s*\d+%\)\s*[\d.]+\s*\(\s*\d+%\)\s*([\d.]+)\s*\(\s*\d+%\))");
+    // .. /usr/include/c++/12/ostream
+    static const QRegularExpression includeRe(R"(^(\.+) (.+)$)");
+
+    totalMs = gccTotalMs(log);
+    QStringList headers;
+    QHash<QString, int> nested;
+    const QStringList lines = log.split('\n');
+    for (const QString &line : lines) {
+        QRegularExpressionMatch include = includeRe.match(line);
+        if (include.hasMatch()) {
+            QString path = include.captured(2).trimmed();
+            if (include.captured(1).size() == 1) {
+                if (!headers.contains(path))
+                    headers << path;
+            } else if (!headers.isEmpty()) {
+                ++nested[headers.last()];
+            }
+            continue;
+        }
+
+        QRegularExpressionMatch phase = phaseRe.match(line);
+        if (!phase.hasMatch())
+            continue;
+        double ms = phase.captured(2).toDouble() * 1000.0;
+        if (ms <= 0)
+            continue;
+        Entry entry;
+        entry.name = phase.captured(1);
+        entry.ms = ms;
+        if (entry.name.startsWith("phase ")) {
+            entry.kind = "Aşama";
+            entry.name = entry.name.mid(6);
+        } else if (entry.name.startsWith("template")) {
+            entry.kind = "Şablon";
+            entry.detail = "GCC yalnızca toplamı verir, ayrıntı için Clang";
+        } else {
+            entry.kind = "Geçiş";
+        }
+        entries.append(entry);
+    }
+
+    priceHeaders(headers, nested);
+}
+
+void CompileProfilePanel::priceHeaders(const QStringList &headers, const QHash<QString, int> &nested) {
+    if (headers.isEmpty()) {
+        showEntries();
+        return;
+    }
+
+    // Each direct include compiled alone: what it costs when nothing else
+    // has pulled in its dependencies yet
+    statusLabel->setText(QString("%1 başlık tek tek ölçülüyor...").arg(headers.size()));
+    int current = generation;
+    auto remaining = std::make_shared<int>(headers.size());
+    for (int i = 0; i < headers.size(); ++i) {
+        QString header = headers[i];
+        QString probe = writeSource(QString("header-%1").arg(i), "#include \"" + header + "\"\n");
+        QStringList arguments;
+        arguments << probe << flags << "-fsyntax-only" << "-ftime-report";
+        pipeline->runStep(compilerProgram(), arguments, [this, current, remaining, header, nested](bool ok,
+                                                                                                 const QString &log) {
+            if (current != generation)
+                return;
+            if (ok) {
+                Entry entry;
+                entry.kind = "Başlık";
+                entry.name = header;
+                entry.ms = gccTotalMs(log);
+                entry.detail = QString("%1 alt başlık, tek başına").arg(nested.value(header));
+                entries.append(entry);
+            }
+            if (--*remaining == 0)
+                showEntries();
+        });
+    }
+}
+
+void CompileProfilePanel::profileWithClang() {
+    statusLabel->setText(compilerProgram() + " -ftime-trace ile derleniyor...");
+    int current = generation;
+    QString object = workDir + "/main.o";
+    QStringList arguments;
+    arguments << sourcePath << flags << "-ftime-trace" << "-c" << "-o" << object;
+    pipeline->runStep(compilerProgram(), arguments, [this, current](bool ok, const QString &log) {
+        if (current != generation)
+            return;
+        if (!ok) {
+            fail("✗ Derleme hatası:\n" + log);
+            return;
+        }
+        // The trace is written next to the object file
+        readClangTrace(workDir + "/main.json");
+    });
+}
+
+void CompileProfilePanel::readClangTrace(const QString &path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        fail("Hata: -ftime-trace çıktısı bulunamadı: " + path);
+        return;
+    }
+
+    struct Total {
+        double us = 0;
+        int count = 0;
+    };
+    QHash<QString, Total> sources;
+    QHash<QString, Total> instantiations;
+    const QJsonArray events = QJsonDocument::fromJson(file.readAll()).object().value("traceEvents").toArray();
+    for (const QJsonValue &value : events) {
+        QJsonObject event = value.toObject();
+        if (event.value("ph").toString() != "X")
+            continue;
+        QString name = event.value("name").toString();
+        double us = event.value("dur").toDouble();
+        QString detail = event.value("args").toObject().value("detail").toString();
+
+        if (name.startsWith("Total ")) {
+            if (name == "Total ExecuteCompiler") {
+                totalMs = us / 1000.0;
+                continue;
+            }
+            Entry entry;
+            entry.kind = "Aşama";
+            entry.name = name.mid(6);
+            entry.ms = us / 1000.0;
+            entry.detail = QString("%1 olay").arg(event.value("args").toObject().value("count").toInt());
+            entries.append(entry);
+        } else if (name == "Source") {
+            Total &total = sources[detail];
+            total.us += us;
+            ++total.count;
+        } else if (name.startsWith("Instantiate")) {
+            Total &total = instantiations[detail];
+            total.us += us;
+            ++total.count;
+        }
+    }
+
+    for (auto it = sources.constBegin(); it != sources.constEnd(); ++it) {
+        Entry entry;
+        entry.kind = "Başlık";
+        entry.name = it.key();
+        entry.ms = it.value().us / 1000.0;
+        entry.detail = "iç içe başlıklar dahil";
+        entries.append(entry);
+    }
+    for (auto it = instantiations.constBegin(); it != instantiations.constEnd(); ++it) {
+        Entry entry;
+        entry.kind = "Şablon";
+        entry.name = it.key();
+        entry.ms = it.value().us / 1000.0;
+        entry.detail = QString("%1 kez").arg(it.value().count);
+        entries.append(entry);
+    }
+
+    showEntries();
+}
+
+void CompileProfilePanel::showEntries() {
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.ms > b.ms; });
+
+    table->setSortingEnabled(false);
+    int rows = qMin(entries.size(), maxRows);
+    table->setRowCount(rows);
+    for (int row = 0; row < rows; ++row) {
+        const Entry &entry = entries[row];
+        QTableWidgetItem *ms = new QTableWidgetItem();
+        ms->setData(Qt::DisplayRole, qRound64(entry.ms * 10.0) / 10.0);
+        QTableWidgetItem *share = new QTableWidgetItem();
+        share->setData(Qt::DisplayRole, totalMs > 0 ? qRound64(1000.0 * entry.ms / totalMs) / 10.0 : 0.0);
+
+        table->setItem(row, 0, new QTableWidgetItem(entry.kind));
+        table->setItem(row, 1, new QTableWidgetItem(entry.name));
+        table->setItem(row, 2, ms);
+        table->setItem(row, 3, share);
+        table->setItem(row, 4, new QTableWidgetItem(entry.detail));
+    }
+    table->setSortingEnabled(true);
+    table->sortItems(2, Qt::DescendingOrder);
+
+    if (minimizeCheck->isChecked())
+        minimizeIncludes();
+    else
+        finish();
+}
+
+void CompileProfilePanel::minimizeIncludes() {
+    static const QRegularExpression includeRe(R"(^\s*#\s*include\s*[<"]([^>"]+)[>"])");
+
+    sourceLines = code.split('\n');
+    includeLines.clear();
+    removable.clear();
+    bulkReplaced = false;
+    int bulk = -1;
+    for (int i = 0; i < sourceLines.size(); ++i) {
+        QRegularExpressionMatch match = includeRe.match(sourceLines[i]);
+        if (!match.hasMatch())
+            continue;
+        includeLines << i;
+        if (match.captured(1) == "bits/stdc++.h")
+            bulk = i;
+    }
+    if (includeLines.isEmpty()) {
+        suggestionEdit->setPlainText("Kodda #include yok.");
+        finish();
+        return;
+    }
+    if (bulk < 0 || language != "C++") {
+        tryWithoutInclude(0);
+        return;
+    }
+
+    // bits/stdc++.h pulls in the whole library; try the headers the code
+    // seems to use instead and keep them if that compiles
+    QStringList guessed;
+    for (const auto &hint : headerHints) {
+        QRegularExpression pattern(QString::fromLatin1(hint[0]));
+        QString header = QString("#include <%1>").arg(QString::fromLatin1(hint[1]));
+        if (pattern.match(code).hasMatch() && !guessed.contains(header))
+            guessed << header;
+    }
+    QStringList candidate = sourceLines;
+    candidate[bulk] = guessed.join('\n');
+    QString probe = writeSource("bulk", candidate.join('\n'));
+
+    statusLabel->setText("bits/stdc++.h yerine tek tek başlıklar deneniyor...");
+    int current = generation;
+    pipeline->runStep(compilerProgram(), QStringList() << probe << flags << "-fsyntax-only",
+                      [this, current, bulk, guessed](bool ok, const QString &) {
+        if (current != generation)
+            return;
+        if (ok) {
+            bulkReplaced = true;
+            sourceLines.removeAt(bulk);
+            for (int i = guessed.size() - 1; i >= 0; --i)
+                sourceLines.insert(bulk, guessed[i]);
+            includeLines.clear();
+            for (int i = 0; i < sourceLines.size(); ++i) {
+                if (includeRe.match(sourceLines[i]).hasMatch())
+                    includeLines << i;
+            }
+        }
+        tryWithoutInclude(0);
+    });
+}
+
+void CompileProfilePanel::tryWithoutInclude(int index) {
+    if (index >= includeLines.size()) {
+        showSuggestion();
+        finish();
+        return;
+    }
+
+    // Blank lines keep the line numbers of the rest of the file
+    QStringList candidate = sourceLines;
+    for (int i = 0; i < includeLines.size(); ++i) {
+        if (i == index || removable.contains(i))
+            candidate[includeLines[i]].clear();
+    }
+    QString probe = writeSource("minimize", candidate.join('\n'));
+
+    statusLabel->setText(QString("Include'lar sadeleştiriliyor (%1/%2)...").arg(index + 1).arg(includeLines.size()));
+    int current = generation;
+    pipeline->runStep(compilerProgram(), QStringList() << probe << flags << "-fsyntax-only",
+                      [this, current, index](bool ok, const QString &) {
+        if (current != generation)
+            return;
+        if (ok)
+            removable.insert(index);
+        tryWithoutInclude(index + 1);
+    });
+}
+
+void CompileProfilePanel::showSuggestion() {
+    QHash<QString, double> headerCost;
+    for (const Entry &entry : entries) {
+        if (entry.kind == "Başlık")
+            headerCost.insert(entry.name, entry.ms);
+    }
+
+    QStringList kept;
+    QStringList dropped;
+    double saved = 0;
+    for (int i = 0; i < includeLines.size(); ++i) {
+        QString line = sourceLines[includeLines[i]].trimmed();
+        if (!removable.contains(i)) {
+            kept << line;
+            continue;
+        }
+        dropped << line;
+        QString name = line.section(QRegularExpression("[<\"]"), 1, 1).section(QRegularExpression("[>\"]"), 0, 0);
+        for (auto it = headerCost.constBegin(); it != headerCost.constEnd(); ++it) {
+            if (it.key() == name || it.key().endsWith("/" + name)) {
+                saved += it.value();
+                break;
+            }
+        }
+    }
+
+    QStringList text;
+    text << "Önerilen include kümesi:" << kept;
+    if (bulkReplaced)
+        text << "" << "bits/stdc++.h yerine yukarıdaki başlıklar yeterli.";
+    if (!dropped.isEmpty()) {
+        text << "" << "Çıkarılabilir (kod onlarsız da derleniyor):" << dropped;
+        if (saved > 0)
+            text << "" << QString("Tahmini kazanç: ~%1 ms (başlıkların tek başına maliyeti)").arg(saved, 0, 'f', 1);
+    } else if (!bulkReplaced) {
+        text << "" << "Gereksiz include bulunamadı.";
+    }
+    suggestionEdit->setPlainText(text.join('\n'));
+}
@@ -0,0 +1,86 @@
+#ifndef COMPILEPROFILEPANEL_H
+#define COMPILEPROFILEPANEL_H
+
+#include <QWidget>
+#include <QHash>
+#include <QSet>
+#include <QVector>
+
+class BuildPipeline;
+class QCheckBox;
+class QComboBox;
+class QLabel;
+class QPlainTextEdit;
+class QPushButton;
+class QTableWidget;
+
+// Where the time of one compile goes. With GCC the -ftime-report phases are
+// combined with the -H include tree, and every directly included header is
+// compiled on its own to price it. With Clang the -ftime-trace Chrome trace
+// already has per-header, per-instantiation and per-phase events. The
+// #include lines can then be minimized by dropping them one at a time for
+// as long as the code still compiles.
+class CompileProfilePanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit CompileProfilePanel(QWidget *parent = nullptr);
+
+    void start(BuildPipeline *pipeline, const QString &language, const QString &code, const QStringList &flags);
+    void showError(const QString &message);
+    bool isRunning() const { return running; }
+
+signals:
+    void runRequested();
+
+private slots:
+    void stop();
+
+private:
+    struct Entry {
+        QString kind;
+        QString name;
+        double ms = 0;
+        QString detail;
+    };
+
+    void profileWithGcc();
+    void profileWithClang();
+    void readGccReport(const QString &log);
+    void priceHeaders(const QStringList &headers, const QHash<QString, int> &nested);
+    void readClangTrace(const QString &path);
+    void showEntries();
+    void minimizeIncludes();
+    void tryWithoutInclude(int index);
+    void showSuggestion();
+    void finish();
+    void fail(const QString &message);
+    QString compilerProgram() const;
+    QString writeSource(const QString &name, const QString &text) const;
+
+    QComboBox *compilerCombo;
+    QCheckBox *minimizeCheck;
+    QPushButton *startButton;
+    QPushButton *stopButton;
+    QLabel *statusLabel;
+    QTableWidget *table;
+    QPlainTextEdit *suggestionEdit;
+
+    BuildPipeline *pipeline = nullptr;
+    bool running = false;
+    int generation = 0;
+    QString language;
+    QString code;
+    QStringList flags;
+    QString workDir;
+    QString sourcePath;
+    QVector<Entry> entries;
+    double totalMs = 0;
+
+    QStringList sourceLines;
+    QVector<int> includeLines;
+    QSet<int> removable;
+    bool bulkReplaced = false;
+};
+
+#endif // COMPILEPROFILEPANEL_H
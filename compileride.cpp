@@ -1,6 +1,30 @@
 #include "compileride.h"
 #include "codeeditor.h"
 #include "syntaxhighlighter.h"
+#include "runstats.h"
+#include "outputviewer.h"
+#include "testpanel.h"
+#include "stresspanel.h"
+#include "resourcemonitor.h"
+#include "scalingpanel.h"
+#include "complexitypanel.h"
+#include "autotunepanel.h"
+#include "pgopanel.h"
+#include "assemblyview.h"
+#include "optimizerremarks.h"
+#include "throughputpanel.h"
+#include "profilerpanel.h"
+#include "coveragecollector.h"
+#include "heappanel.h"
+#include "pythonprofilerpanel.h"
+#include "nodeprofilerpanel.h"
+#include "jsrunner.h"
+#include "pythonhost.h"
+#include "hotreload.h"
+#include "compileprofilepanel.h"
+#include "binarysizepanel.h"
+#include "buildpipeline.h"
+#include "languagebackend.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QSplitter>
@@ -11,14 +35,30 @@
 #include <QMenuBar>
 #include <QMenu>
 #include <QAction>
+#include <QActionGroup>
 #include <QToolBar>
 #include <QStatusBar>
 #include <QTextStream>
 #include <QFontDialog>
 #include <QSettings>
 #include <QTextCursor>
+#include <QTextBlock>
+#include <QDir>
+#include <QFileInfo>
+#include <QTabWidget>
+#include <QLineEdit>
+#include <QCheckBox>
+#include <QInputDialog>
+#include <memory>
 
 CompilerIDE::CompilerIDE(QWidget *parent) : QMainWindow(parent) {
+    buildPipeline = new BuildPipeline(sessionDir.path(), this);
+    optimizerRemarks = new OptimizerRemarks(this);
+    coverageCollector = new CoverageCollector(this);
+    jsRunner = new JsRunner(this);
+    pythonHost = new PythonHost(this);
+    hotReloadHost = new HotReloadHost(this);
+
     setupUI();
     setupMenuBar();
     setupToolBar();
@@ -42,6 +82,11 @@ CompilerIDE::CompilerIDE(QWidget *parent) : QMainWindow(parent) {
                  "padding: 5px; border-radius: 3px; }"
                  "QComboBox::drop-down { border: none; }"
                  "QComboBox::down-arrow { image: none; border: none; }"
+                 "QTabWidget::pane { border: none; }"
+                 "QTabBar::tab { background-color: #2d2d30; color: #cccccc; padding: 5px 12px; }"
+                 "QTabBar::tab:selected { background-color: #1e1e1e; }"
+                 "QLineEdit { background-color: #3c3c3c; color: #cccccc; border: 1px solid #454545; "
+                 "padding: 4px; border-radius: 3px; }"
                  "QStatusBar { background-color: #007acc; color: white; }");
 }
 
@@ -56,11 +101,22 @@ void CompilerIDE::setupUI() {
     topBar->setContentsMargins(10, 5, 10, 5);
 
     languageCombo = new QComboBox();
-    languageCombo->addItems({"C++", "C", "Python", "JavaScript"});
+    languageCombo->addItems(LanguageBackend::languages());
     languageCombo->setMinimumWidth(150);
     connect(languageCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
             this, &CompilerIDE::onLanguageChanged);
 
+    // Python only: which interpreter runs the script
+    interpreterLabel = new QLabel("Yorumlayıcı:");
+    interpreterCombo = new QComboBox();
+    interpreterCombo->addItems(BuildPipeline::availableInterpreters("Python"));
+    interpreterCombo->setToolTip("Bulunan CPython sürümleri ve PyPy");
+    connect(interpreterCombo, &QComboBox::currentTextChanged, this, [this](const QString &name) {
+        buildPipeline->setInterpreter("Python", name);
+    });
+    if (interpreterCombo->count() > 0)
+        buildPipeline->setInterpreter("Python", interpreterCombo->currentText());
+
     runButton = new QPushButton("▶ Çalıştır (F5)");
     runButton->setShortcut(QKeySequence(Qt::Key_F5));
     connect(runButton, &QPushButton::clicked, this, &CompilerIDE::runCode);
@@ -68,10 +124,33 @@ void CompilerIDE::setupUI() {
     clearButton = new QPushButton("🗑 Temizle");
     connect(clearButton, &QPushButton::clicked, this, &CompilerIDE::clearOutput);
 
+    inputCombo = new QComboBox();
+    inputCombo->addItems({"Yok", "Metin", "Dosya"});
+    connect(inputCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &CompilerIDE::onInputModeChanged);
+
+    inputFileButton = new QPushButton("📂 Girdi Dosyası");
+    inputFileButton->setEnabled(false);
+    connect(inputFileButton, &QPushButton::clicked, this, &CompilerIDE::chooseInputFile);
+
+    outputCombo = new QComboBox();
+    outputCombo->addItems({"Panel", "Dosya", "/dev/null", "Görüntüleyici"});
+    outputCombo->setToolTip("Dosya ve /dev/null modlarında çıktı panelden geçmez, "
+                            "ölçülen süre yalnızca programa aittir");
+
     topBar->addWidget(new QLabel("Dil:"));
     topBar->addWidget(languageCombo);
+    topBar->addWidget(interpreterLabel);
+    topBar->addWidget(interpreterCombo);
     topBar->addWidget(runButton);
     topBar->addWidget(clearButton);
+    topBar->addSpacing(20);
+    topBar->addWidget(new QLabel("Girdi:"));
+    topBar->addWidget(inputCombo);
+    topBar->addWidget(inputFileButton);
+    topBar->addSpacing(20);
+    topBar->addWidget(new QLabel("Çıktı:"));
+    topBar->addWidget(outputCombo);
     topBar->addStretch();
 
     mainLayout->addLayout(topBar);
@@ -91,8 +170,121 @@ void CompilerIDE::setupUI() {
                              "border: none; }");
     outputEdit->setFont(QFont("Consolas", 10));
 
+    inputEdit = new QPlainTextEdit();
+    inputEdit->setPlaceholderText("Program girdisi (stdin)...");
+    inputEdit->setStyleSheet("QPlainTextEdit { background-color: #1e1e1e; color: #d4d4d4; "
+                            "border: none; border-left: 1px solid #454545; }");
+    inputEdit->setFont(QFont("Consolas", 10));
+    inputEdit->setVisible(false);
+
+    // Output and stdin side by side
+    QSplitter *ioSplitter = new QSplitter(Qt::Horizontal);
+    ioSplitter->addWidget(outputEdit);
+    ioSplitter->addWidget(inputEdit);
+    ioSplitter->setSizes({800, 400});
+
+    bottomTabs = new QTabWidget();
+    bottomTabs->addTab(ioSplitter, "Çıktı");
+    bottomTabs->addTab(createViewerPage(), "Görüntüleyici");
+
+    testPanel = new TestPanel();
+    connect(testPanel, &TestPanel::runRequested, this, &CompilerIDE::runTests);
+    bottomTabs->addTab(testPanel, "Testler");
+
+    stressPanel = new StressPanel();
+    connect(stressPanel, &StressPanel::runRequested, this, &CompilerIDE::runStress);
+    bottomTabs->addTab(stressPanel, "Stres Testi");
+
+    resourceMonitor = new ResourceMonitor();
+    bottomTabs->addTab(resourceMonitor, "Kaynaklar");
+
+    scalingPanel = new ScalingPanel();
+    connect(scalingPanel, &ScalingPanel::runRequested, this, &CompilerIDE::runScalingSweep);
+    bottomTabs->addTab(scalingPanel, "Ölçekleme");
+
+    complexityPanel = new ComplexityPanel();
+    connect(complexityPanel, &ComplexityPanel::runRequested, this, &CompilerIDE::runComplexitySweep);
+    bottomTabs->addTab(complexityPanel, "Karmaşıklık");
+
+    autotunePanel = new AutotunePanel();
+    connect(autotunePanel, &AutotunePanel::runRequested, this, &CompilerIDE::runAutotune);
+    connect(autotunePanel, &AutotunePanel::applyRequested, this, &CompilerIDE::applyCompilerFlags);
+    bottomTabs->addTab(autotunePanel, "Otomatik Ayar");
+
+    pgoPanel = new PgoPanel();
+    connect(pgoPanel, &PgoPanel::runRequested, this, &CompilerIDE::runPgo);
+    bottomTabs->addTab(pgoPanel, "PGO");
+
+    assemblyView = new AssemblyView();
+    connect(assemblyView, &AssemblyView::refreshRequested, this, &CompilerIDE::refreshAssembly);
+    connect(assemblyView, &AssemblyView::mappingChanged, this, &CompilerIDE::updateEditorHighlights);
+    connect(assemblyView, &AssemblyView::sourceLineActivated, this, &CompilerIDE::goToSourceLine);
+    connect(codeEditor, &QPlainTextEdit::textChanged, assemblyView, &AssemblyView::sourceEdited);
+    connect(codeEditor, &QPlainTextEdit::cursorPositionChanged, this, [this]() {
+        if (bottomTabs->currentWidget() == assemblyView)
+            assemblyView->showSourceLine(codeEditor->textCursor().blockNumber() + 1);
+    });
+    bottomTabs->addTab(assemblyView, "Assembly");
+
+    throughputPanel = new ThroughputPanel();
+    connect(throughputPanel, &ThroughputPanel::runRequested, this, &CompilerIDE::analyzeThroughput);
+    connect(codeEditor, &CodeEditor::analyzeSelectionRequested, this, &CompilerIDE::analyzeThroughput);
+    bottomTabs->addTab(throughputPanel, "Verim");
+
+    compileProfilePanel = new CompileProfilePanel();
+    connect(compileProfilePanel, &CompileProfilePanel::runRequested, this, &CompilerIDE::runCompileProfile);
+    bottomTabs->addTab(compileProfilePanel, "Derleme Profili");
+
+    binarySizePanel = new BinarySizePanel();
+    connect(binarySizePanel, &BinarySizePanel::runRequested, this, &CompilerIDE::runSizeReport);
+    bottomTabs->addTab(binarySizePanel, "Boyut");
+
+    profilerPanel = new ProfilerPanel();
+    connect(profilerPanel, &ProfilerPanel::runRequested, this, &CompilerIDE::runProfiler);
+    connect(profilerPanel, &ProfilerPanel::sourceLineActivated, this, &CompilerIDE::goToSourceLine);
+    connect(profilerPanel, &ProfilerPanel::lineHeatReady, this, &CompilerIDE::showLineHeat);
+    bottomTabs->addTab(profilerPanel, "Profil");
+
+    heapPanel = new HeapPanel();
+    connect(heapPanel, &HeapPanel::sourceLineActivated, this, &CompilerIDE::goToSourceLine);
+    connect(heapPanel, &HeapPanel::reportReady, this, [this]() {
+        bottomTabs->setCurrentWidget(heapPanel);
+    });
+    bottomTabs->addTab(heapPanel, "Bellek");
+
+    pythonProfilerPanel = new PythonProfilerPanel();
+    connect(pythonProfilerPanel, &PythonProfilerPanel::runRequested, this, &CompilerIDE::runPythonProfile);
+    connect(pythonProfilerPanel, &PythonProfilerPanel::sourceLineActivated, this, &CompilerIDE::goToSourceLine);
+    connect(pythonProfilerPanel, &PythonProfilerPanel::lineHeatReady, this, &CompilerIDE::showLineHeat);
+    bottomTabs->addTab(pythonProfilerPanel, "Python Profili");
+
+    nodeProfilerPanel = new NodeProfilerPanel();
+    connect(nodeProfilerPanel, &NodeProfilerPanel::runRequested, this, &CompilerIDE::runNodeProfile);
+    connect(nodeProfilerPanel, &NodeProfilerPanel::sourceLineActivated, this, &CompilerIDE::goToSourceLine);
+    connect(nodeProfilerPanel, &NodeProfilerPanel::lineHeatReady, this, &CompilerIDE::showLineHeat);
+    bottomTabs->addTab(nodeProfilerPanel, "Node Profili");
+
+    connect(coverageCollector, &CoverageCollector::coverageReady, this, &CompilerIDE::showLineHeat);
+    connect(coverageCollector, &CoverageCollector::failed, this, [this](const QString &message) {
+        statusBar()->showMessage(message.section('\n', 0, 0), 5000);
+    });
+
+    // Gutter data follows edits line by line inside the editor
+    connect(optimizerRemarks, &OptimizerRemarks::remarksReady, this,
+            [this](const QHash<int, LineAnnotation> &annotations, int count) {
+        codeEditor->setAnnotations("remarks", annotations);
+        statusBar()->showMessage(QString("%1 optimizasyon notu").arg(count), 3000);
+    });
+    connect(codeEditor, &QPlainTextEdit::textChanged, this, &CompilerIDE::restoreLineHeat);
+
+    connect(bottomTabs, &QTabWidget::currentChanged, this, [this]() {
+        if (bottomTabs->currentWidget() == assemblyView)
+            refreshAssembly();
+        updateEditorHighlights();
+    });
+
     splitter->addWidget(codeEditor);
-    splitter->addWidget(outputEdit);
+    splitter->addWidget(bottomTabs);
     splitter->setSizes({600, 200});
 
     mainLayout->addWidget(splitter);
@@ -101,6 +293,50 @@ void CompilerIDE::setupUI() {
     loadTemplate("C++");
 }
 
+QWidget *CompilerIDE::createViewerPage() {
+    viewerPage = new QWidget();
+    QVBoxLayout *layout = new QVBoxLayout(viewerPage);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->setSpacing(0);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+    bar->setContentsMargins(5, 3, 5, 3);
+
+    viewerSearchEdit = new QLineEdit();
+    viewerSearchEdit->setPlaceholderText("Ara...");
+    connect(viewerSearchEdit, &QLineEdit::returnPressed, this, &CompilerIDE::findInViewer);
+
+    QPushButton *findButton = new QPushButton("Sonraki");
+    connect(findButton, &QPushButton::clicked, this, &CompilerIDE::findInViewer);
+
+    viewerLineEdit = new QLineEdit();
+    viewerLineEdit->setPlaceholderText("Satıra git");
+    viewerLineEdit->setMaximumWidth(120);
+    connect(viewerLineEdit, &QLineEdit::returnPressed, this, &CompilerIDE::goToViewerLine);
+
+    QCheckBox *followCheck = new QCheckBox("Sonu takip et");
+    followCheck->setStyleSheet("QCheckBox { color: #cccccc; }");
+    followCheck->setChecked(true);
+
+    QLabel *viewerStatus = new QLabel();
+    viewerStatus->setStyleSheet("QLabel { color: #cccccc; }");
+
+    bar->addWidget(viewerSearchEdit);
+    bar->addWidget(findButton);
+    bar->addWidget(viewerLineEdit);
+    bar->addWidget(followCheck);
+    bar->addStretch();
+    bar->addWidget(viewerStatus);
+
+    outputViewer = new OutputViewer();
+    connect(outputViewer, &OutputViewer::statusChanged, viewerStatus, &QLabel::setText);
+    connect(followCheck, &QCheckBox::toggled, outputViewer, &OutputViewer::setFollowTail);
+
+    layout->addLayout(bar);
+    layout->addWidget(outputViewer);
+    return viewerPage;
+}
+
 void CompilerIDE::setupMenuBar() {
     QMenuBar *menuBar = new QMenuBar(this);
 
@@ -196,10 +432,208 @@ void CompilerIDE::setupMenuBar() {
     connect(runAct, &QAction::triggered, this, &CompilerIDE::runCode);
     runMenu->addAction(runAct);
 
+    QAction *testAct = new QAction("Testleri Çalıştır", this);
+    testAct->setShortcut(Qt::Key_F6);
+    connect(testAct, &QAction::triggered, this, &CompilerIDE::runTests);
+    runMenu->addAction(testAct);
+
+    QAction *stressAct = new QAction("Stres Testi", this);
+    stressAct->setShortcut(Qt::Key_F7);
+    connect(stressAct, &QAction::triggered, this, &CompilerIDE::runStress);
+    runMenu->addAction(stressAct);
+
+    QAction *profileAct = new QAction("Profil ile Çalıştır", this);
+    profileAct->setShortcut(Qt::Key_F8);
+    connect(profileAct, &QAction::triggered, this, &CompilerIDE::runProfiler);
+    runMenu->addAction(profileAct);
+
+    runMenu->addSeparator();
+
+    monitorAct = new QAction("Kaynakları İzle", this);
+    monitorAct->setCheckable(true);
+    monitorAct->setChecked(true);
+    runMenu->addAction(monitorAct);
+
+    heapAct = new QAction("Bellek Profili Çıkar", this);
+    heapAct->setCheckable(true);
+    heapAct->setToolTip("C/C++ programlarının bellek ayırmalarını çağrı yerine göre say");
+    runMenu->addAction(heapAct);
+
+    jsInProcessAct = new QAction("JavaScript'i Süreç İçinde Çalıştır", this);
+    jsInProcessAct->setCheckable(true);
+    jsInProcessAct->setToolTip("Node başlatmadan QJSEngine ile çalıştır; "
+                               "Node API'leri kullanan betikler yine node ile çalışır");
+    runMenu->addAction(jsInProcessAct);
+
+    QAction *stopJsAct = new QAction("Süreç İçi JavaScript'i Durdur", this);
+    stopJsAct->setShortcut(QKeySequence("Shift+F5"));
+    connect(stopJsAct, &QAction::triggered, jsRunner, &JsRunner::stop);
+    runMenu->addAction(stopJsAct);
+
+    warmPythonAct = new QAction("Python'u Sıcak Yorumlayıcıda Çalıştır", this);
+    warmPythonAct->setCheckable(true);
+    if (PythonHost::isAvailable()) {
+        warmPythonAct->setToolTip(QString("Gömülü CPython %1 modülleri bir kez yükler, "
+                                          "her çalıştırma temiz bir alt süreçte başlar")
+                                      .arg(PythonHost::version()));
+    } else {
+        warmPythonAct->setEnabled(false);
+        warmPythonAct->setToolTip("Bu derleme CODEIDE_EMBED_PYTHON olmadan yapılmış");
+    }
+    connect(warmPythonAct, &QAction::toggled, this, [this](bool on) {
+        if (on)
+            pythonHost->warmUp();
+        else
+            pythonHost->shutdown();
+    });
+    runMenu->addAction(warmPythonAct);
+
+    QAction *preloadAct = new QAction("Önceden Yüklenecek Python Modülleri...", this);
+    preloadAct->setEnabled(PythonHost::isAvailable());
+    connect(preloadAct, &QAction::triggered, this, &CompilerIDE::editPythonPreload);
+    runMenu->addAction(preloadAct);
+
+    hotReloadAct = new QAction("Sıcak Yeniden Yükleme (setup/step)", this);
+    hotReloadAct->setCheckable(true);
+    hotReloadAct->setToolTip("C/C++ kodu paylaşımlı kütüphane olarak derlenir: extern \"C\" void *setup() "
+                             "bir kez çalışır, extern \"C\" int step(void *state) her çalıştırmada "
+                             "saklanan durumla ayrı bir alt süreçte çalışır");
+    connect(hotReloadAct, &QAction::toggled, this, [this](bool on) {
+        if (!on)
+            hotReloadHost->reset();
+    });
+    runMenu->addAction(hotReloadAct);
+
+    QAction *resetStateAct = new QAction("Sıcak Durumu Sıfırla", this);
+    connect(resetStateAct, &QAction::triggered, this, [this]() {
+        hotReloadHost->reset();
+        statusBar()->showMessage("Durum silindi, sonraki çalıştırmada setup() yeniden çalışacak", 3000);
+    });
+    runMenu->addAction(resetStateAct);
+
+    QAction *flagsAct = new QAction("Derleyici Bayrakları...", this);
+    connect(flagsAct, &QAction::triggered, this, &CompilerIDE::editCompilerFlags);
+    runMenu->addAction(flagsAct);
+
+    // Per toolchain; the menu shows the choice for the current language
+    linkerMenu = runMenu->addMenu("Bağlayıcı");
+    linkerGroup = new QActionGroup(this);
+    static const char *linkerChoices[][2] = {
+        {"", "Otomatik (en hızlı bulunan)"},
+        {"bfd", "Derleyicinin varsayılanı"},
+        {"gold", "gold"},
+        {"lld", "lld"},
+        {"mold", "mold"},
+    };
+    const QStringList installedLinkers = BuildPipeline::availableLinkers();
+    for (const auto &choice : linkerChoices) {
+        QString name = QString::fromLatin1(choice[0]);
+        QAction *action = linkerMenu->addAction(QString::fromUtf8(choice[1]));
+        action->setCheckable(true);
+        action->setData(name);
+        if (name != "" && name != "bfd" && !installedLinkers.contains(name)) {
+            action->setEnabled(false);
+            action->setToolTip("Kurulu değil");
+        }
+        linkerGroup->addAction(action);
+    }
+    linkerMenu->setToolTipsVisible(true);
+    connect(linkerGroup, &QActionGroup::triggered, this, [this](QAction *action) {
+        QString lang = languageCombo->currentText();
+        if (!BuildPipeline::isCompiled(lang))
+            return;
+        buildPipeline->setLinker(lang, action->data().toString());
+        QString linker = buildPipeline->linker(lang);
+        statusBar()->showMessage(lang + " bağlayıcısı: " + (linker.isEmpty() ? "varsayılan" : linker), 3000);
+    });
+
+    splitDwarfAct = new QAction("Hata Ayıklama Bilgisini Ayır (-gsplit-dwarf)", this);
+    splitDwarfAct->setCheckable(true);
+    splitDwarfAct->setToolTip("-g ile yapılan derlemelerde DWARF bilgisi .dwo dosyasında kalır, "
+                              "bağlayıcı onu kopyalamadığı için bağlama hızlanır");
+#ifdef Q_OS_WIN
+    splitDwarfAct->setEnabled(false);
+#endif
+    connect(splitDwarfAct, &QAction::toggled, buildPipeline, &BuildPipeline::setSplitDwarf);
+    runMenu->addAction(splitDwarfAct);
+
     QAction *clearOutputAct = new QAction("Çıktıyı Temizle", this);
     connect(clearOutputAct, &QAction::triggered, this, &CompilerIDE::clearOutput);
     runMenu->addAction(clearOutputAct);
 
+    // Analysis menu
+    QMenu *analysisMenu = menuBar->addMenu("Analiz");
+
+    QAction *scalingAct = new QAction("İş Parçacığı Ölçekleme", this);
+    connect(scalingAct, &QAction::triggered, this, &CompilerIDE::runScalingSweep);
+    analysisMenu->addAction(scalingAct);
+
+    QAction *complexityAct = new QAction("Girdi Boyutu Taraması (Karmaşıklık)", this);
+    connect(complexityAct, &QAction::triggered, this, &CompilerIDE::runComplexitySweep);
+    analysisMenu->addAction(complexityAct);
+
+    QAction *autotuneAct = new QAction("Derleyici Bayraklarını Otomatik Ayarla", this);
+    connect(autotuneAct, &QAction::triggered, this, &CompilerIDE::runAutotune);
+    analysisMenu->addAction(autotuneAct);
+
+    QAction *pgoAct = new QAction("Profil Güdümlü Optimizasyon (PGO)", this);
+    connect(pgoAct, &QAction::triggered, this, &CompilerIDE::runPgo);
+    analysisMenu->addAction(pgoAct);
+
+    analysisMenu->addSeparator();
+
+    QAction *assemblyAct = new QAction("Assembly Görünümü", this);
+    connect(assemblyAct, &QAction::triggered, this, [this]() {
+        bottomTabs->setCurrentWidget(assemblyView);
+    });
+    analysisMenu->addAction(assemblyAct);
+
+    remarksAct = new QAction("Optimizasyon Notlarını Göster", this);
+    remarksAct->setCheckable(true);
+    remarksAct->setToolTip("Vektörleştirme ve satır içi açma notlarını satır numaralarının yanında göster");
+    connect(remarksAct, &QAction::toggled, this, [this](bool checked) {
+        if (!checked)
+            codeEditor->setAnnotations("remarks", QHash<int, LineAnnotation>());
+    });
+    analysisMenu->addAction(remarksAct);
+
+    QAction *throughputAct = new QAction("Seçimin Verimini Analiz Et (llvm-mca)", this);
+    connect(throughputAct, &QAction::triggered, this, &CompilerIDE::analyzeThroughput);
+    analysisMenu->addAction(throughputAct);
+
+    QAction *compileProfileAct = new QAction("Derlemeyi Profille", this);
+    compileProfileAct->setToolTip("Derleme süresini aşamalara, başlıklara ve şablonlara böl");
+    connect(compileProfileAct, &QAction::triggered, this, &CompilerIDE::runCompileProfile);
+    analysisMenu->addAction(compileProfileAct);
+
+    QAction *sizeReportAct = new QAction("Boyut ve Başlangıç Raporu", this);
+    sizeReportAct->setToolTip("Programın bölüm, sembol ve şablon boyutlarını, statik başlatıcılarını ve "
+                              "başlangıç maliyetini dinamik/statik, soyulmuş/soyulmamış karşılaştır");
+    connect(sizeReportAct, &QAction::triggered, this, &CompilerIDE::runSizeReport);
+    analysisMenu->addAction(sizeReportAct);
+
+    analysisMenu->addSeparator();
+
+    QAction *coverageAct = new QAction("Kapsam ile Çalıştır", this);
+    coverageAct->setToolTip("--coverage ile derleyip çalıştır, satır başına çalışma sayılarını göster");
+    connect(coverageAct, &QAction::triggered, this, &CompilerIDE::runCoverage);
+    analysisMenu->addAction(coverageAct);
+
+    QAction *stopCoverageAct = new QAction("Kapsam Toplamayı Durdur", this);
+    connect(stopCoverageAct, &QAction::triggered, coverageCollector, &CoverageCollector::stop);
+    analysisMenu->addAction(stopCoverageAct);
+
+    heatAct = new QAction("Isı Şeridini Göster", this);
+    heatAct->setCheckable(true);
+    heatAct->setToolTip("Profil örneklerini veya kapsam sayılarını satır numaralarının yanında göster");
+    connect(heatAct, &QAction::toggled, this, [this](bool checked) {
+        if (checked)
+            restoreLineHeat();
+        else
+            codeEditor->setLineHeat(LineHeat());
+    });
+    analysisMenu->addAction(heatAct);
+
     // Help menu
     QMenu *helpMenu = menuBar->addMenu("Yardım");
 
@@ -266,12 +700,23 @@ void CompilerIDE::onLanguageChanged(int index) {
     QString lang = languageCombo->currentText();
     highlighter->setLanguage(lang);
     updateStatusBar();
+    interpreterLabel->setVisible(lang == "Python");
+    interpreterCombo->setVisible(lang == "Python");
+    updateLinkerMenu();
 
     if (codeEditor->toPlainText().isEmpty()) {
         loadTemplate(lang);
     }
 }
 
+void CompilerIDE::updateLinkerMenu() {
+    QString lang = languageCombo->currentText();
+    linkerMenu->setEnabled(BuildPipeline::isCompiled(lang));
+    QString preference = buildPipeline->linkerPreference(lang);
+    for (QAction *action : linkerGroup->actions())
+        action->setChecked(action->data().toString() == preference);
+}
+
 void CompilerIDE::runCode() {
     QString lang = languageCombo->currentText();
     QString code = codeEditor->toPlainText();
@@ -284,155 +729,700 @@ void CompilerIDE::runCode() {
     outputEdit->clear();
     outputEdit->append("=== Derleniyor ve Çalıştırılıyor ===\n");
 
-    if (lang == "C++") {
-        compileCpp(code);
-    } else if (lang == "C") {
-        compileC(code);
-    } else if (lang == "Python") {
-        runPython(code);
-    } else if (lang == "JavaScript") {
-        runJavaScript(code);
+    if (remarksAct->isChecked())
+        optimizerRemarks->collect(buildPipeline, lang, code, compilerFlags(lang));
+
+    buildAndRun(lang, code);
+}
+
+void CompilerIDE::buildAndRun(const QString &lang, const QString &code) {
+    const LanguageBackend *backend = LanguageBackend::find(lang);
+    if (!backend)
+        return;
+
+    // Run modes that replace the regular build
+    if (backend->isCompiled() && hotReloadAct->isChecked()) {
+        runHotReload(lang, code);
+        return;
+    }
+    if (lang == "JavaScript" && jsInProcessAct->isChecked()) {
+        if (!JsRunner::needsNode(code)) {
+            runJavaScriptInProcess(code);
+            return;
+        }
+        outputEdit->append("Betik Node API'leri kullanıyor, node ile çalıştırılıyor\n");
+    }
+
+    // Call sites in the heap profile need line tables
+    QStringList flags = compilerFlags(lang);
+    if (backend->isCompiled() && heapAct->isChecked())
+        flags << "-g";
+    buildPipeline->build(lang, code, flags, [this, lang, backend](const RunTarget &target, const QString &log) {
+        showDiagnostics(backend->parseDiagnostics(log));
+        if (!target.isValid()) {
+            if (backend->isCompiled())
+                outputEdit->append("✗ Derleme hatası:\n");
+            outputEdit->append(log);
+            return;
+        }
+        if (!backend->isCompiled()) {
+            if (lang == "Python" && warmPythonAct->isChecked())
+                runPythonWarm(target);
+            else
+                startProgram(target.program, target.arguments);
+            return;
+        }
+        outputEdit->append("✓ Derleme başarılı!\n");
+        outputEdit->append("=== Program Çıktısı ===\n");
+        startCompiledProgram(lang, target);
+    });
+}
+
+void CompilerIDE::showDiagnostics(const QVector<Diagnostic> &diagnostics) {
+    // Errors win over warnings on the same line, the tooltip lists both
+    QHash<int, LineAnnotation> markers;
+    for (const Diagnostic &diagnostic : diagnostics) {
+        LineAnnotation &marker = markers[diagnostic.line];
+        QString text = QString("%1:%2: %3").arg(diagnostic.line).arg(diagnostic.column).arg(diagnostic.message);
+        marker.toolTip = marker.toolTip.isEmpty() ? text : marker.toolTip + "\n" + text;
+        if (diagnostic.error) {
+            marker.symbol = "✗";
+            marker.color = QColor(241, 76, 76);
+        } else if (marker.symbol.isEmpty()) {
+            marker.symbol = "⚠";
+            marker.color = QColor(204, 167, 0);
+        }
+    }
+    codeEditor->setAnnotations("diagnostics", markers);
+}
+
+void CompilerIDE::startCompiledProgram(const QString &language, const RunTarget &target) {
+    statusBar()->showMessage(QString("Program %1 KB, ayrıntılar için Analiz > Boyut ve Başlangıç Raporu")
+                                 .arg(QFileInfo(target.program).size() / 1024.0, 0, 'f', 1), 5000);
+
+    if (!heapAct->isChecked()) {
+        startProgram(target.program, target.arguments);
+        return;
     }
+
+    heapPanel->prepare(buildPipeline, language, target, [this, target](const QProcessEnvironment &environment) {
+        QProcess *process = startProgram(target.program, target.arguments, environment);
+        if (!environment.isEmpty())
+            connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+                    heapPanel, &HeapPanel::collect);
+    });
 }
 
-void CompilerIDE::compileCpp(const QString &code) {
-    QFile file("temp.cpp");
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        outputEdit->append("Hata: Dosya oluşturulamadı!");
+void CompilerIDE::runJavaScriptInProcess(const QString &code) {
+    if (jsRunner->isRunning()) {
+        outputEdit->append("Hata: Önceki JavaScript çalışması henüz bitmedi! Durdurmak için Shift+F5.");
         return;
     }
 
-    QTextStream out(&file);
-    out << code;
-    file.close();
+    QString runDir = createRunDirectory();
+    QString input;
+    QString inputPath = prepareInputFile(runDir);
+    if (!inputPath.isEmpty()) {
+        QFile file(inputPath);
+        if (file.open(QIODevice::ReadOnly))
+            input = QString::fromUtf8(file.readAll());
+    }
 
-    QProcess *process = new QProcess(this);
-    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
-            [this, process](int exitCode, QProcess::ExitStatus exitStatus) {
-        Q_UNUSED(exitStatus);
-        if (exitCode == 0) {
-            outputEdit->append("✓ Derleme başarılı!\n");
-            outputEdit->append("=== Program Çıktısı ===\n");
-
-            QProcess *runProcess = new QProcess(this);
-            connect(runProcess, &QProcess::readyReadStandardOutput, [this, runProcess]() {
-                outputEdit->append(runProcess->readAllStandardOutput());
-            });
-            connect(runProcess, &QProcess::readyReadStandardError, [this, runProcess]() {
-                outputEdit->append("Hata: " + runProcess->readAllStandardError());
-            });
+    std::shared_ptr<RunSpool> spool = openSpool(runDir);
+    QObject *run = new QObject(this);
+    connect(jsRunner, &JsRunner::output, run, [this, spool](int stream, const QString &text) {
+        writeSpool(*spool, stream == JsRunner::StandardError, text);
+    });
+    connect(jsRunner, &JsRunner::finished, run, [this, run, spool](bool ok, const QString &summary) {
+        Q_UNUSED(ok);
+        closeSpool(*spool);
+        outputEdit->append("\n=== " + summary + " ===");
+        disconnect(jsRunner, nullptr, run, nullptr);
+        run->deleteLater();
+    });
 
-#ifdef Q_OS_WIN
-            runProcess->start("temp.exe");
-#else
-            runProcess->start("./temp");
-#endif
-        } else {
-            outputEdit->append("✗ Derleme hatası:\n");
-            outputEdit->append(process->readAllStandardError());
-        }
-        process->deleteLater();
+    jsRunner->start(code, input);
+}
+
+void CompilerIDE::runPythonWarm(const RunTarget &target) {
+    // Finishes the previous run before this one hooks up to the helper
+    if (pythonHost->isRunning())
+        pythonHost->shutdown();
+
+    QString runDir = createRunDirectory();
+    QString statsFile = runDir + "/stats.txt";
+    QString inputPath = prepareInputFile(runDir);
+    spoolForkServerRun(pythonHost, runDir, statsFile, "sıcak yorumlayıcı");
+    pythonHost->run(target.arguments.last(), inputPath, statsFile);
+}
+
+void CompilerIDE::runHotReload(const QString &language, const QString &code) {
+    if (hotReloadHost->isBusy()) {
+        outputEdit->append("Hata: Önceki adım henüz bitmedi! Durdurmak için Sıcak Durumu Sıfırla.");
+        return;
+    }
+
+    QString runDir = createRunDirectory();
+    QString statsFile = runDir + "/stats.txt";
+    QString inputPath = prepareInputFile(runDir);
+    spoolForkServerRun(hotReloadHost, runDir, statsFile, "step()");
+    hotReloadHost->run(buildPipeline, language, code, compilerFlags(language), inputPath, statsFile);
+}
+
+void CompilerIDE::spoolForkServerRun(ForkServer *server, const QString &runDir, const QString &statsFile,
+                                     const QString &label) {
+    std::shared_ptr<RunSpool> spool = openSpool(runDir);
+    QObject *run = new QObject(this);
+    auto finish = [this, server, run, spool](const QString &summary) {
+        closeSpool(*spool);
+        outputEdit->append("\n=== " + summary + " ===");
+        disconnect(server, nullptr, run, nullptr);
+        run->deleteLater();
+    };
+    connect(server, &ForkServer::output, run, [this, spool](int stream, const QByteArray &data) {
+        writeSpool(*spool, stream == ForkServer::StandardError, QString::fromUtf8(data));
     });
+    connect(server, &ForkServer::finished, run, [finish, statsFile, label]() {
+        finish(RunStats::load(statsFile).summary() + " (" + label + ")");
+    });
+    connect(server, &ForkServer::failed, run, [finish](const QString &message) {
+        finish(message);
+    });
+}
 
-#ifdef Q_OS_WIN
-    process->start("g++", QStringList() << "temp.cpp" << "-o" << "temp.exe");
-#else
-    process->start("g++", QStringList() << "temp.cpp" << "-o" << "temp");
-#endif
+std::shared_ptr<CompilerIDE::RunSpool> CompilerIDE::openSpool(const QString &runDir) {
+    auto spool = std::make_shared<RunSpool>();
+    spool->mode = outputCombo->currentText();
+    spool->runDir = runDir;
+    if (spool->mode == "Dosya") {
+        spool->out.setFileName(runDir + "/stdout.txt");
+        spool->err.setFileName(runDir + "/stderr.txt");
+        spool->out.open(QIODevice::WriteOnly);
+        spool->err.open(QIODevice::WriteOnly);
+    } else if (spool->mode == "Görüntüleyici") {
+        spool->out.setFileName(runDir + "/output.log");
+        spool->out.open(QIODevice::WriteOnly);
+        outputViewer->openFile(spool->out.fileName());
+        outputViewer->setLive(true);
+        bottomTabs->setCurrentWidget(viewerPage);
+    }
+    return spool;
 }
 
-void CompilerIDE::compileC(const QString &code) {
-    QFile file("temp.c");
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        outputEdit->append("Hata: Dosya oluşturulamadı!");
+void CompilerIDE::writeSpool(RunSpool &spool, bool error, const QString &text) {
+    if (spool.mode == "Panel") {
+        QString chunk = text;
+        if (chunk.endsWith('\n'))
+            chunk.chop(1);
+        outputEdit->append(error ? "Hata: " + chunk : chunk);
         return;
     }
+    QFile &file = error && spool.err.isOpen() ? spool.err : spool.out;
+    if (file.isOpen()) {
+        file.write(text.toUtf8());
+        file.flush();
+    }
+}
 
-    QTextStream out(&file);
-    out << code;
-    file.close();
+void CompilerIDE::closeSpool(RunSpool &spool) {
+    spool.out.close();
+    spool.err.close();
+    if (spool.mode == "Dosya") {
+        showOutputPreview("stdout", spool.runDir + "/stdout.txt");
+        showOutputPreview("stderr", spool.runDir + "/stderr.txt");
+    } else if (spool.mode == "Görüntüleyici") {
+        outputViewer->setLive(false);
+        outputEdit->append(QString("Çıktı görüntüleyicide: %1 (%2 satır)")
+                               .arg(spool.runDir + "/output.log")
+                               .arg(outputViewer->lineCount()));
+    }
+}
 
-    QProcess *process = new QProcess(this);
-    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
-            [this, process](int exitCode, QProcess::ExitStatus exitStatus) {
-        Q_UNUSED(exitStatus);
-        if (exitCode == 0) {
-            outputEdit->append("✓ Derleme başarılı!\n");
-            outputEdit->append("=== Program Çıktısı ===\n");
-
-            QProcess *runProcess = new QProcess(this);
-            connect(runProcess, &QProcess::readyReadStandardOutput, [this, runProcess]() {
-                outputEdit->append(runProcess->readAllStandardOutput());
-            });
-            connect(runProcess, &QProcess::readyReadStandardError, [this, runProcess]() {
-                outputEdit->append("Hata: " + runProcess->readAllStandardError());
-            });
+QStringList CompilerIDE::compilerFlags(const QString &lang) const {
+    if (!BuildPipeline::isCompiled(lang))
+        return QStringList();
+    return BuildPipeline::splitFlags(languageFlags.value(lang));
+}
 
-#ifdef Q_OS_WIN
-            runProcess->start("temp.exe");
-#else
-            runProcess->start("./temp");
-#endif
-        } else {
-            outputEdit->append("✗ Derleme hatası:\n");
-            outputEdit->append(process->readAllStandardError());
+void CompilerIDE::runTests() {
+    QString lang = languageCombo->currentText();
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || testPanel->isRunning())
+        return;
+
+    bottomTabs->setCurrentWidget(testPanel);
+    if (testPanel->isEmpty()) {
+        statusBar()->showMessage("Test yok: önce test ekleyin", 3000);
+        return;
+    }
+    buildPipeline->build(lang, code, compilerFlags(lang), [this](const RunTarget &target, const QString &log) {
+        if (!target.isValid()) {
+            showBuildError(log);
+            return;
         }
-        process->deleteLater();
+        testPanel->runAll(target, createRunDirectory());
     });
-
-#ifdef Q_OS_WIN
-    process->start("gcc", QStringList() << "temp.c" << "-o" << "temp.exe");
-#else
-    process->start("gcc", QStringList() << "temp.c" << "-o" << "temp");
-#endif
 }
 
-void CompilerIDE::runPython(const QString &code) {
-    QFile file("temp.py");
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        outputEdit->append("Hata: Dosya oluşturulamadı!");
+void CompilerIDE::runStress() {
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || stressPanel->isRunning())
+        return;
+
+    bottomTabs->setCurrentWidget(stressPanel);
+    if (stressPanel->generatorCode().isEmpty() || stressPanel->bruteCode().isEmpty()) {
+        stressPanel->showError("Hata: Üreteç ve doğru çözüm boş olamaz!");
         return;
     }
 
-    QTextStream out(&file);
-    out << code;
-    file.close();
+    struct StressBuild {
+        RunTarget targets[3];
+        int remaining = 3;
+        QString errors;
+    };
+    auto state = std::make_shared<StressBuild>();
+
+    const QStringList names = {"Üreteç", "Doğru çözüm", "Çözüm"};
+    const QStringList languages = {stressPanel->generatorLanguage(), stressPanel->bruteLanguage(),
+                                   languageCombo->currentText()};
+    const QStringList sources = {stressPanel->generatorCode(), stressPanel->bruteCode(), code};
+
+    // All three build in parallel; the last one to finish starts the loop
+    for (int i = 0; i < 3; ++i) {
+        buildPipeline->build(languages[i], sources[i], QStringList(),
+                             [this, state, i, names](const RunTarget &target, const QString &log) {
+            state->targets[i] = target;
+            if (!target.isValid())
+                state->errors += names[i] + ":\n" + log + "\n";
+            if (--state->remaining > 0)
+                return;
+
+            if (!state->errors.isEmpty()) {
+                stressPanel->showError("✗ Derleme hatası:\n" + state->errors);
+                return;
+            }
+            stressPanel->start(state->targets[0], state->targets[1], state->targets[2],
+                               createRunDirectory());
+        });
+    }
+}
 
-    QProcess *process = new QProcess(this);
-    connect(process, &QProcess::readyReadStandardOutput, [this, process]() {
-        outputEdit->append(process->readAllStandardOutput());
+void CompilerIDE::runScalingSweep() {
+    QString lang = languageCombo->currentText();
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || scalingPanel->isRunning())
+        return;
+
+    bottomTabs->setCurrentWidget(scalingPanel);
+    QStringList flags = BuildPipeline::isCompiled(lang) ? scalingPanel->buildFlags() : QStringList();
+    buildPipeline->build(lang, code, flags, [this](const RunTarget &target, const QString &log) {
+        if (!target.isValid()) {
+            scalingPanel->showError("✗ Derleme hatası, ayrıntılar Çıktı sekmesinde");
+            showBuildError(log);
+            return;
+        }
+        QString runDir = createRunDirectory();
+        scalingPanel->start(target, prepareInputFile(runDir), runDir);
     });
-    connect(process, &QProcess::readyReadStandardError, [this, process]() {
-        outputEdit->append("Hata: " + process->readAllStandardError());
+}
+
+void CompilerIDE::runComplexitySweep() {
+    QString lang = languageCombo->currentText();
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || complexityPanel->isRunning())
+        return;
+
+    bottomTabs->setCurrentWidget(complexityPanel);
+    QStringList flags = BuildPipeline::isCompiled(lang) ? complexityPanel->buildFlags() : QStringList();
+    buildPipeline->build(lang, code, flags, [this](const RunTarget &target, const QString &log) {
+        if (!target.isValid()) {
+            showBuildError(log);
+            return;
+        }
+        if (!complexityPanel->usesGenerator()) {
+            complexityPanel->start(target, RunTarget(), createRunDirectory());
+            return;
+        }
+
+        if (stressPanel->generatorCode().isEmpty()) {
+            complexityPanel->showError("Hata: Stres Testi sekmesinde üreteç yok!");
+            return;
+        }
+        buildPipeline->build(stressPanel->generatorLanguage(), stressPanel->generatorCode(), QStringList(),
+                             [this, target](const RunTarget &generator, const QString &log) {
+            if (!generator.isValid()) {
+                showBuildError(log);
+                return;
+            }
+            complexityPanel->start(target, generator, createRunDirectory());
+        });
     });
-    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
-            [process]() { process->deleteLater(); });
+}
+
+void CompilerIDE::runAutotune() {
+    QString lang = languageCombo->currentText();
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || autotunePanel->isRunning())
+        return;
+
+    bottomTabs->setCurrentWidget(autotunePanel);
+    QString runDir = createRunDirectory();
+    autotunePanel->start(buildPipeline, lang, code, prepareInputFile(runDir), runDir);
+}
+
+void CompilerIDE::runPgo() {
+    QString lang = languageCombo->currentText();
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || pgoPanel->isRunning())
+        return;
+
+    bottomTabs->setCurrentWidget(pgoPanel);
+    QString runDir = createRunDirectory();
+    pgoPanel->start(buildPipeline, lang, code, compilerFlags(lang), prepareInputFile(runDir), runDir);
+}
+
+void CompilerIDE::refreshAssembly() {
+    assemblyView->refresh(buildPipeline, languageCombo->currentText(), codeEditor->toPlainText());
+}
+
+void CompilerIDE::updateEditorHighlights() {
+    // Source lines are tinted only while their assembly is on screen
+    if (bottomTabs->currentWidget() == assemblyView)
+        codeEditor->setLineHighlights(assemblyView->sourceLineColors());
+    else
+        codeEditor->setLineHighlights(QHash<int, QColor>());
+}
+
+void CompilerIDE::analyzeThroughput() {
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || throughputPanel->isRunning())
+        return;
+
+    // Whole lines covered by the selection, or just the cursor line
+    QTextCursor cursor = codeEditor->textCursor();
+    QTextDocument *document = codeEditor->document();
+    QTextBlock lastBlock = document->findBlock(cursor.selectionEnd());
+    int first = document->findBlock(cursor.selectionStart()).blockNumber() + 1;
+    int last = lastBlock.blockNumber() + 1;
+    if (last > first && cursor.selectionEnd() == lastBlock.position())
+        --last;
+
+    bottomTabs->setCurrentWidget(throughputPanel);
+    throughputPanel->analyze(buildPipeline, languageCombo->currentText(), code, first, last);
+}
+
+void CompilerIDE::runCompileProfile() {
+    QString lang = languageCombo->currentText();
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || compileProfilePanel->isRunning())
+        return;
+
+    bottomTabs->setCurrentWidget(compileProfilePanel);
+    if (!BuildPipeline::isCompiled(lang)) {
+        compileProfilePanel->showError("Hata: Derleme profili yalnızca C/C++ kodu için kullanılabilir!");
+        return;
+    }
+    compileProfilePanel->start(buildPipeline, lang, code, compilerFlags(lang));
+}
+
+void CompilerIDE::runSizeReport() {
+    QString lang = languageCombo->currentText();
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || binarySizePanel->isRunning())
+        return;
 
-    process->start("python", QStringList() << "temp.py");
+    bottomTabs->setCurrentWidget(binarySizePanel);
+    if (!BuildPipeline::isCompiled(lang)) {
+        binarySizePanel->showError("Hata: Boyut raporu yalnızca C/C++ kodu için kullanılabilir!");
+        return;
+    }
+    binarySizePanel->start(buildPipeline, lang, code, compilerFlags(lang));
 }
 
-void CompilerIDE::runJavaScript(const QString &code) {
-    QFile file("temp.js");
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        outputEdit->append("Hata: Dosya oluşturulamadı!");
+void CompilerIDE::runProfiler() {
+    QString lang = languageCombo->currentText();
+    if (lang == "Python") {
+        runPythonProfile();
+        return;
+    }
+    if (lang == "JavaScript") {
+        runNodeProfile();
         return;
     }
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || profilerPanel->isRunning())
+        return;
 
-    QTextStream out(&file);
-    out << code;
-    file.close();
+    bottomTabs->setCurrentWidget(profilerPanel);
+    QString runDir = createRunDirectory();
+    profilerPanel->start(buildPipeline, lang, code, compilerFlags(lang), prepareInputFile(runDir), runDir);
+}
+
+void CompilerIDE::runPythonProfile() {
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || pythonProfilerPanel->isRunning())
+        return;
+
+    bottomTabs->setCurrentWidget(pythonProfilerPanel);
+    if (languageCombo->currentText() != "Python") {
+        pythonProfilerPanel->showError("Hata: Python profili yalnızca Python kodu için kullanılabilir!");
+        return;
+    }
+    QString runDir = createRunDirectory();
+    pythonProfilerPanel->start(buildPipeline, code, prepareInputFile(runDir), runDir);
+}
+
+void CompilerIDE::runNodeProfile() {
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty() || nodeProfilerPanel->isRunning())
+        return;
+
+    bottomTabs->setCurrentWidget(nodeProfilerPanel);
+    if (languageCombo->currentText() != "JavaScript") {
+        nodeProfilerPanel->showError("Hata: Node profili yalnızca JavaScript kodu için kullanılabilir!");
+        return;
+    }
+    QString runDir = createRunDirectory();
+    nodeProfilerPanel->start(buildPipeline, code, prepareInputFile(runDir), runDir);
+}
+
+void CompilerIDE::runCoverage() {
+    QString lang = languageCombo->currentText();
+    QString code = codeEditor->toPlainText();
+    if (code.isEmpty())
+        return;
+
+    statusBar()->showMessage("Kapsam toplanıyor...");
+    QString runDir = createRunDirectory();
+    coverageCollector->collect(buildPipeline, lang, code, compilerFlags(lang), prepareInputFile(runDir), runDir);
+}
+
+void CompilerIDE::showLineHeat(const QString &sourceKey, const LineHeat &heat) {
+    heatCache.insert(sourceKey, heat);
+    statusBar()->showMessage(QString("Isı verisi: %1 satır").arg(heat.counts.size()), 3000);
+    // Counts for an older revision would land on the wrong lines
+    if (sourceKey == BuildPipeline::sourceKey(languageCombo->currentText(), codeEditor->toPlainText()))
+        restoreLineHeat();
+}
+
+void CompilerIDE::restoreLineHeat() {
+    // Undoing back to a measured revision brings its counts back in full.
+    // setupUI loads the first template before the menus exist.
+    if (!heatAct || !heatAct->isChecked())
+        return;
+    auto cached = heatCache.constFind(BuildPipeline::sourceKey(languageCombo->currentText(),
+                                                               codeEditor->toPlainText()));
+    if (cached != heatCache.cend())
+        codeEditor->setLineHeat(cached.value());
+}
+
+void CompilerIDE::goToSourceLine(int line) {
+    QTextCursor cursor(codeEditor->document()->findBlockByNumber(line - 1));
+    codeEditor->setTextCursor(cursor);
+    codeEditor->ensureCursorVisible();
+}
+
+void CompilerIDE::applyCompilerFlags(const QString &language, const QStringList &flags) {
+    if (!BuildPipeline::isCompiled(language))
+        return;
+    languageFlags.insert(language, flags.join(' '));
+    statusBar()->showMessage(language + " bayrakları: " + flags.join(' '), 3000);
+}
+
+void CompilerIDE::editPythonPreload() {
+    bool ok;
+    QString modules = QInputDialog::getText(this, "Sıcak Yorumlayıcı", "Önceden yüklenecek modüller:",
+                                            QLineEdit::Normal, pythonHost->preloadModules().join(' '), &ok);
+    if (!ok)
+        return;
+    pythonHost->setPreloadModules(BuildPipeline::splitFlags(modules));
+    if (warmPythonAct->isChecked())
+        pythonHost->warmUp();
+}
+
+void CompilerIDE::editCompilerFlags() {
+    QString lang = languageCombo->currentText();
+    if (!BuildPipeline::isCompiled(lang)) {
+        statusBar()->showMessage(lang + " derlenmiyor, bayrak kullanılmaz", 3000);
+        return;
+    }
+
+    bool ok;
+    QString flags = QInputDialog::getText(this, "Derleyici Bayrakları", lang + " bayrakları:",
+                                          QLineEdit::Normal, compilerFlags(lang).join(' '), &ok);
+    if (ok)
+        applyCompilerFlags(lang, BuildPipeline::splitFlags(flags));
+}
+
+QProcess *CompilerIDE::startProgram(const QString &program, const QStringList &arguments,
+                                    const QProcessEnvironment &environment) {
+    QString runDir = createRunDirectory();
+    QString statsFile = runDir + "/stats.txt";
+    QString outputMode = outputCombo->currentText();
 
     QProcess *process = new QProcess(this);
-    connect(process, &QProcess::readyReadStandardOutput, [this, process]() {
-        outputEdit->append(process->readAllStandardOutput());
-    });
-    connect(process, &QProcess::readyReadStandardError, [this, process]() {
-        outputEdit->append("Hata: " + process->readAllStandardError());
+    if (!environment.isEmpty())
+        process->setProcessEnvironment(environment);
+    if (outputMode == "Panel") {
+        connect(process, &QProcess::readyReadStandardOutput, [this, process]() {
+            outputEdit->append(process->readAllStandardOutput());
+        });
+        connect(process, &QProcess::readyReadStandardError, [this, process]() {
+            outputEdit->append("Hata: " + process->readAllStandardError());
+        });
+    } else if (outputMode == "Dosya") {
+        process->setStandardOutputFile(runDir + "/stdout.txt");
+        process->setStandardErrorFile(runDir + "/stderr.txt");
+    } else if (outputMode == "Görüntüleyici") {
+        // Spool both streams into one file and page it from disk
+        process->setProcessChannelMode(QProcess::MergedChannels);
+        process->setStandardOutputFile(runDir + "/output.log");
+    } else {
+        process->setStandardOutputFile(QProcess::nullDevice());
+        process->setStandardErrorFile(QProcess::nullDevice());
+    }
+
+    connect(process, &QProcess::errorOccurred, [this, program](QProcess::ProcessError error) {
+        if (error == QProcess::FailedToStart)
+            outputEdit->append("Hata: " + program + " başlatılamadı!");
     });
+    bool monitored = monitorAct->isChecked();
+    if (monitored) {
+        connect(process, &QProcess::started, [this, process]() {
+            resourceMonitor->attach(process->processId());
+        });
+    }
+
     connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
-            [process]() { process->deleteLater(); });
+            [this, process, runDir, statsFile, outputMode, monitored]() {
+        RunStats stats = RunStats::load(statsFile);
+        if (monitored)
+            resourceMonitor->detach(stats);
+
+        if (outputMode == "Dosya") {
+            showOutputPreview("stdout", runDir + "/stdout.txt");
+            showOutputPreview("stderr", runDir + "/stderr.txt");
+        } else if (outputMode == "Görüntüleyici") {
+            outputViewer->setLive(false);
+            outputEdit->append(QString("Çıktı görüntüleyicide: %1 (%2 satır)")
+                                   .arg(runDir + "/output.log")
+                                   .arg(outputViewer->lineCount()));
+        }
+        outputEdit->append("\n=== " + stats.summary() + " ===");
+        process->deleteLater();
+    });
+
+    QString wrappedProgram = program;
+    QStringList wrappedArguments = arguments;
+    MeasuredRun::wrap(wrappedProgram, wrappedArguments, statsFile);
+
+    attachInput(process);
+    process->start(wrappedProgram, wrappedArguments);
+    feedInput(process);
+
+    if (outputMode == "Görüntüleyici") {
+        outputViewer->openFile(runDir + "/output.log");
+        outputViewer->setLive(true);
+        bottomTabs->setCurrentWidget(viewerPage);
+    }
+    return process;
+}
+
+void CompilerIDE::attachInput(QProcess *process) {
+    QString mode = inputCombo->currentText();
+    if (mode == "Dosya" && !inputFile.isEmpty()) {
+        // The child gets the file descriptor itself as stdin, so even very
+        // large inputs are read straight from the file and never copied
+        // through this process.
+        process->setStandardInputFile(inputFile);
+    } else if (mode != "Metin") {
+        // Programs reading stdin see EOF instead of blocking forever
+        process->setStandardInputFile(QProcess::nullDevice());
+    }
+}
+
+void CompilerIDE::feedInput(QProcess *process) {
+    if (inputCombo->currentText() != "Metin")
+        return;
 
-    process->start("node", QStringList() << "temp.js");
+    process->write(inputEdit->toPlainText().toUtf8());
+    process->closeWriteChannel();
+}
+
+QString CompilerIDE::createRunDirectory() {
+    QString path = QDir(sessionDir.path()).filePath(QString("run-%1").arg(++runCounter));
+    QDir().mkpath(path);
+    return path;
+}
+
+QString CompilerIDE::prepareInputFile(const QString &runDir) {
+    QString mode = inputCombo->currentText();
+    if (mode == "Dosya")
+        return inputFile;
+    if (mode != "Metin")
+        return QString();
+
+    QString path = runDir + "/stdin.txt";
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly))
+        return QString();
+    file.write(inputEdit->toPlainText().toUtf8());
+    return path;
+}
+
+void CompilerIDE::showBuildError(const QString &log) {
+    outputEdit->clear();
+    outputEdit->append("✗ Derleme hatası:\n");
+    outputEdit->append(log);
+    bottomTabs->setCurrentIndex(0);
+}
+
+void CompilerIDE::showOutputPreview(const QString &title, const QString &path) {
+    static const qint64 previewBytes = 4 * 1024;
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly) || file.size() == 0)
+        return;
+
+    outputEdit->append(QString("=== %1 (%2 bayt, %3) ===").arg(title).arg(file.size()).arg(path));
+    if (file.size() <= 2 * previewBytes) {
+        outputEdit->append(QString::fromUtf8(file.readAll()));
+        return;
+    }
+
+    outputEdit->append(QString::fromUtf8(file.read(previewBytes)));
+    outputEdit->append(QString("... [%1 bayt atlandı] ...").arg(file.size() - 2 * previewBytes));
+    file.seek(file.size() - previewBytes);
+    outputEdit->append(QString::fromUtf8(file.read(previewBytes)));
+}
+
+void CompilerIDE::onInputModeChanged(int index) {
+    Q_UNUSED(index);
+    QString mode = inputCombo->currentText();
+    inputEdit->setVisible(mode == "Metin");
+    inputFileButton->setEnabled(mode == "Dosya");
+}
+
+void CompilerIDE::chooseInputFile() {
+    QString fileName = QFileDialog::getOpenFileName(this, "Girdi Dosyası Seç", inputFile,
+        "Text Files (*.txt *.in);;All Files (*.*)");
+
+    if (!fileName.isEmpty()) {
+        inputFile = fileName;
+        inputFileButton->setToolTip(fileName);
+        statusBar()->showMessage("Girdi dosyası: " + fileName, 3000);
+    }
+}
+
+void CompilerIDE::findInViewer() {
+    outputViewer->find(viewerSearchEdit->text());
+}
+
+void CompilerIDE::goToViewerLine() {
+    bool ok;
+    qint64 line = viewerLineEdit->text().toLongLong(&ok);
+    if (ok && line > 0)
+        outputViewer->goToLine(line - 1);
 }
 
 void CompilerIDE::clearOutput() {
@@ -452,8 +1442,11 @@ void CompilerIDE::newFile() {
 }
 
 void CompilerIDE::openFile() {
-    QString fileName = QFileDialog::getOpenFileName(this, "Dosya Aç", "",
-        "C++ Files (*.cpp *.h);;C Files (*.c *.h);;Python Files (*.py);;JavaScript Files (*.js);;All Files (*.*)");
+    QStringList filters;
+    for (const QString &lang : LanguageBackend::languages())
+        filters << LanguageBackend::find(lang)->fileFilter();
+    filters << "All Files (*.*)";
+    QString fileName = QFileDialog::getOpenFileName(this, "Dosya Aç", "", filters.join(";;"));
 
     if (!fileName.isEmpty()) {
         QFile file(fileName);
@@ -464,15 +1457,8 @@ void CompilerIDE::openFile() {
             file.close();
 
             // Auto-detect language
-            if (fileName.endsWith(".cpp") || fileName.endsWith(".h")) {
-                languageCombo->setCurrentText("C++");
-            } else if (fileName.endsWith(".c")) {
-                languageCombo->setCurrentText("C");
-            } else if (fileName.endsWith(".py")) {
-                languageCombo->setCurrentText("Python");
-            } else if (fileName.endsWith(".js")) {
-                languageCombo->setCurrentText("JavaScript");
-            }
+            if (const LanguageBackend *backend = LanguageBackend::forFile(fileName))
+                languageCombo->setCurrentText(backend->name());
         }
     }
 }
@@ -493,12 +1479,8 @@ void CompilerIDE::saveFile() {
 
 void CompilerIDE::saveFileAs() {
     QString filter;
-    QString lang = languageCombo->currentText();
-
-    if (lang == "C++") filter = "C++ Files (*.cpp);;Header Files (*.h)";
-    else if (lang == "C") filter = "C Files (*.c);;Header Files (*.h)";
-    else if (lang == "Python") filter = "Python Files (*.py)";
-    else if (lang == "JavaScript") filter = "JavaScript Files (*.js)";
+    if (const LanguageBackend *backend = LanguageBackend::find(languageCombo->currentText()))
+        filter = backend->fileFilter();
 
     QString fileName = QFileDialog::getSaveFileName(this, "Farklı Kaydet", "", filter);
 
@@ -523,59 +1505,14 @@ void CompilerIDE::about() {
         "<h2>CodeIDE v1.0</h2>"
         "<p>Multi-Language Compiler & IDE</p>"
         "<p>Desteklenen Diller:</p>"
-        "<ul><li>C++</li><li>C</li><li>Python</li><li>JavaScript</li></ul>"
+        "<ul><li>" + LanguageBackend::languages().join("</li><li>") + "</li></ul>"
         "<p>© 2025 CodeIDE & Onur Lexa</p>"
         "<p>Duyuru: 21.10.2025 tarihinden itibaren ingilizce desteği gelecektir!");
 }
 
 void CompilerIDE::loadTemplate(const QString &lang) {
-    QString code;
-
-    if (lang == "C++") {
-        code = "#include <iostream>\n"
-               "#include <vector>\n"
-               "#include <string>\n\n"
-               "using namespace std;\n\n"
-               "int main() {\n"
-               "    cout << \"Merhaba C++!\" << endl;\n"
-               "    \n"
-               "    // Kodunuzu buraya yazın\n"
-               "    \n"
-               "    return 0;\n"
-               "}\n";
-    } else if (lang == "C") {
-        code = "#include <stdio.h>\n"
-               "#include <stdlib.h>\n"
-               "#include <string.h>\n\n"
-               "int main() {\n"
-               "    printf(\"Merhaba C!\\n\");\n"
-               "    \n"
-               "    // Kodunuzu buraya yazın\n"
-               "    \n"
-               "    return 0;\n"
-               "}\n";
-    } else if (lang == "Python") {
-        code = "#!/usr/bin/env python3\n"
-               "# -*- coding: utf-8 -*-\n\n"
-               "def main():\n"
-               "    print(\"Merhaba Python!\")\n"
-               "    \n"
-               "    # Kodunuzu buraya yazın\n"
-               "    \n\n"
-               "if __name__ == \"__main__\":\n"
-               "    main()\n";
-    } else if (lang == "JavaScript") {
-        code = "// JavaScript Code\n\n"
-               "function main() {\n"
-               "    console.log(\"Merhaba JavaScript!\");\n"
-               "    \n"
-               "    // Kodunuzu buraya yazın\n"
-               "    \n"
-               "}\n\n"
-               "main();\n";
-    }
-
-    codeEditor->setPlainText(code);
+    const LanguageBackend *backend = LanguageBackend::find(lang);
+    codeEditor->setPlainText(backend ? backend->templateCode() : QString());
 }
 
 void CompilerIDE::loadSettings() {
@@ -586,6 +1523,42 @@ void CompilerIDE::loadSettings() {
     QString lastLang = settings.value("language", "C++").toString();
     int index = languageCombo->findText(lastLang);
     if (index >= 0) languageCombo->setCurrentIndex(index);
+    index = interpreterCombo->findText(settings.value("pythonInterpreter").toString());
+    if (index >= 0) interpreterCombo->setCurrentIndex(index);
+    interpreterLabel->setVisible(languageCombo->currentText() == "Python");
+    interpreterCombo->setVisible(languageCombo->currentText() == "Python");
+
+    inputFile = settings.value("inputFile").toString();
+    inputFileButton->setToolTip(inputFile);
+    inputEdit->setPlainText(settings.value("inputText").toString());
+    index = inputCombo->findText(settings.value("inputMode", "Yok").toString());
+    if (index >= 0) inputCombo->setCurrentIndex(index);
+    index = outputCombo->findText(settings.value("outputMode", "Panel").toString());
+    if (index >= 0) outputCombo->setCurrentIndex(index);
+    monitorAct->setChecked(settings.value("monitorResources", true).toBool());
+    remarksAct->setChecked(settings.value("optimizerRemarks", false).toBool());
+    heatAct->setChecked(settings.value("lineHeat", true).toBool());
+    heapAct->setChecked(settings.value("heapProfile", false).toBool());
+    jsInProcessAct->setChecked(settings.value("jsInProcess", false).toBool());
+    pythonHost->setPreloadModules(BuildPipeline::splitFlags(
+        settings.value("pythonPreload", "numpy pandas scipy").toString()));
+    warmPythonAct->setChecked(PythonHost::isAvailable() && settings.value("warmPython", false).toBool());
+    hotReloadAct->setChecked(settings.value("hotReload", false).toBool());
+    // Flags were stored as cppFlags/cFlags before there were backends
+    static const QHash<QString, QString> legacyFlagKeys = {{"C++", "cppFlags"}, {"C", "cFlags"}};
+    for (const QString &lang : LanguageBackend::languages()) {
+        if (!BuildPipeline::isCompiled(lang))
+            continue;
+        QVariant legacy = settings.value(legacyFlagKeys.value(lang));
+        languageFlags.insert(lang, settings.value("flags/" + lang, legacy).toString());
+        buildPipeline->setLinker(lang, settings.value("linker/" + lang).toString());
+    }
+    updateLinkerMenu();
+#ifdef Q_OS_WIN
+    splitDwarfAct->setChecked(false);
+#else
+    splitDwarfAct->setChecked(settings.value("splitDwarf", true).toBool());
+#endif
 }
 
 void CompilerIDE::saveSettings() {
@@ -593,6 +1566,26 @@ void CompilerIDE::saveSettings() {
     settings.setValue("geometry", saveGeometry());
     settings.setValue("windowState", saveState());
     settings.setValue("language", languageCombo->currentText());
+    settings.setValue("pythonInterpreter", interpreterCombo->currentText());
+    settings.setValue("inputMode", inputCombo->currentText());
+    settings.setValue("inputFile", inputFile);
+    settings.setValue("inputText", inputEdit->toPlainText());
+    settings.setValue("outputMode", outputCombo->currentText());
+    settings.setValue("monitorResources", monitorAct->isChecked());
+    settings.setValue("optimizerRemarks", remarksAct->isChecked());
+    settings.setValue("lineHeat", heatAct->isChecked());
+    settings.setValue("heapProfile", heapAct->isChecked());
+    settings.setValue("jsInProcess", jsInProcessAct->isChecked());
+    settings.setValue("pythonPreload", pythonHost->preloadModules().join(' '));
+    settings.setValue("warmPython", warmPythonAct->isChecked());
+    settings.setValue("hotReload", hotReloadAct->isChecked());
+    for (const QString &lang : LanguageBackend::languages()) {
+        if (!BuildPipeline::isCompiled(lang))
+            continue;
+        settings.setValue("flags/" + lang, languageFlags.value(lang));
+        settings.setValue("linker/" + lang, buildPipeline->linkerPreference(lang));
+    }
+    settings.setValue("splitDwarf", splitDwarfAct->isChecked());
 }
 
 void CompilerIDE::closeEvent(QCloseEvent *event) {
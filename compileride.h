@@ -6,8 +6,47 @@
 #include <QComboBox>
 #include <QPushButton>
 #include <QLabel>
+#include <QPlainTextEdit>
+#include <QTemporaryDir>
+#include <QProcessEnvironment>
+#include <QHash>
+#include <QVector>
+#include <QFile>
+#include <memory>
+#include "codeeditor.h"
 
-class CodeEditor;
+class QProcess;
+
+class OutputViewer;
+class TestPanel;
+class StressPanel;
+class ResourceMonitor;
+class ScalingPanel;
+class ComplexityPanel;
+class AutotunePanel;
+class PgoPanel;
+class AssemblyView;
+class OptimizerRemarks;
+class ThroughputPanel;
+class ProfilerPanel;
+class CoverageCollector;
+class HeapPanel;
+class PythonProfilerPanel;
+class NodeProfilerPanel;
+class JsRunner;
+class PythonHost;
+class HotReloadHost;
+class ForkServer;
+class CompileProfilePanel;
+class BinarySizePanel;
+struct RunTarget;
+struct Diagnostic;
+class QAction;
+class QActionGroup;
+class QMenu;
+class BuildPipeline;
+class QTabWidget;
+class QLineEdit;
 class SyntaxHighlighter;
 
 class CompilerIDE : public QMainWindow {
@@ -30,31 +69,131 @@ private slots:
     void changeFont();
     void about();
     void updateStatusBar();
+    void onInputModeChanged(int index);
+    void chooseInputFile();
+    void findInViewer();
+    void goToViewerLine();
+    void runTests();
+    void runStress();
+    void runScalingSweep();
+    void runComplexitySweep();
+    void runAutotune();
+    void runPgo();
+    void refreshAssembly();
+    void updateEditorHighlights();
+    void analyzeThroughput();
+    void runCompileProfile();
+    void runSizeReport();
+    void runProfiler();
+    void runPythonProfile();
+    void runNodeProfile();
+    void runCoverage();
+    void showLineHeat(const QString &sourceKey, const LineHeat &heat);
+    void restoreLineHeat();
+    void goToSourceLine(int line);
+    void applyCompilerFlags(const QString &language, const QStringList &flags);
+    void editCompilerFlags();
+    void editPythonPreload();
 
 private:
+    // Output of a run that does not come through a QProcess pipe (in-process
+    // JavaScript, warm Python), routed to the selected output mode
+    struct RunSpool {
+        QString mode;
+        QString runDir;
+        QFile out;
+        QFile err;
+    };
+
     void setupUI();
     void setupMenuBar();
     void setupToolBar();
     void setupStatusBar();
+    QWidget *createViewerPage();
     void loadTemplate(const QString &lang);
     void loadSettings();
+    void updateLinkerMenu();
     void saveSettings();
 
-    void compileCpp(const QString &code);
-    void compileC(const QString &code);
-    void runPython(const QString &code);
-    void runJavaScript(const QString &code);
+    void buildAndRun(const QString &lang, const QString &code);
+    void showDiagnostics(const QVector<Diagnostic> &diagnostics);
+    void runJavaScriptInProcess(const QString &code);
+    void runPythonWarm(const RunTarget &target);
+    void runHotReload(const QString &language, const QString &code);
+    void spoolForkServerRun(ForkServer *server, const QString &runDir, const QString &statsFile,
+                            const QString &label);
+    std::shared_ptr<RunSpool> openSpool(const QString &runDir);
+    void writeSpool(RunSpool &spool, bool error, const QString &text);
+    void closeSpool(RunSpool &spool);
+    QStringList compilerFlags(const QString &lang) const;
+
+    void startCompiledProgram(const QString &language, const RunTarget &target);
+    QProcess *startProgram(const QString &program, const QStringList &arguments,
+                           const QProcessEnvironment &environment = QProcessEnvironment());
+    void attachInput(QProcess *process);
+    void feedInput(QProcess *process);
+    QString createRunDirectory();
+    QString prepareInputFile(const QString &runDir);
+    void showBuildError(const QString &log);
+    void showOutputPreview(const QString &title, const QString &path);
 
     CodeEditor *codeEditor;
     QTextEdit *outputEdit;
+    QTabWidget *bottomTabs;
+    OutputViewer *outputViewer;
+    TestPanel *testPanel;
+    StressPanel *stressPanel;
+    ResourceMonitor *resourceMonitor;
+    ScalingPanel *scalingPanel;
+    ComplexityPanel *complexityPanel;
+    AutotunePanel *autotunePanel;
+    PgoPanel *pgoPanel;
+    AssemblyView *assemblyView;
+    OptimizerRemarks *optimizerRemarks;
+    QAction *remarksAct;
+    ThroughputPanel *throughputPanel;
+    CompileProfilePanel *compileProfilePanel;
+    BinarySizePanel *binarySizePanel;
+    ProfilerPanel *profilerPanel;
+    CoverageCollector *coverageCollector;
+    QAction *heatAct = nullptr;
+    QHash<QString, LineHeat> heatCache;
+    HeapPanel *heapPanel;
+    QAction *heapAct;
+    PythonProfilerPanel *pythonProfilerPanel;
+    NodeProfilerPanel *nodeProfilerPanel;
+    JsRunner *jsRunner;
+    QAction *jsInProcessAct;
+    PythonHost *pythonHost;
+    QAction *warmPythonAct;
+    HotReloadHost *hotReloadHost;
+    QAction *hotReloadAct;
+    QAction *monitorAct;
+    QMenu *linkerMenu;
+    QActionGroup *linkerGroup;
+    QAction *splitDwarfAct;
+    BuildPipeline *buildPipeline;
+    QWidget *viewerPage;
+    QLineEdit *viewerSearchEdit;
+    QLineEdit *viewerLineEdit;
     QComboBox *languageCombo;
+    QLabel *interpreterLabel;
+    QComboBox *interpreterCombo;
     QPushButton *runButton;
     QPushButton *clearButton;
+    QComboBox *inputCombo;
+    QPushButton *inputFileButton;
+    QComboBox *outputCombo;
+    QPlainTextEdit *inputEdit;
     QLabel *statusLabel;
     QLabel *lineColLabel;
     QLabel *langLabel;
     SyntaxHighlighter *highlighter;
     QString currentFile;
+    QString inputFile;
+    QHash<QString, QString> languageFlags;
+    QTemporaryDir sessionDir;
+    int runCounter = 0;
 };
 
 #endif // COMPILERIDE_H
\ No newline at end of file
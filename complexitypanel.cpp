@@ -0,0 +1,397 @@
+#include "complexitypanel.h"
+#include "benchmarkrunner.h"
+#include "plotwidget.h"
+#include <QComboBox>
+#include <QDir>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QLineEdit>
+#include <QProcess>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QSplitter>
+#include <QTableWidget>
+#include <QTimer>
+#include <QVBoxLayout>
+#include <algorithm>
+#include <cmath>
+
+static const int modelCount = 6;
+// Far beyond anything a sweep can run, and n³ of it still fits a double
+static const qint64 maxSize = 1000000000000LL;
+static const char *modelNames[modelCount] = {"O(1)", "O(log n)", "O(n)", "O(n log n)", "O(n²)", "O(n³)"};
+
+ComplexityPanel::ComplexityPanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+
+    methodCombo = new QComboBox();
+    methodCombo->addItems({"Argüman", "Ortam değişkeni", "Üreteç"});
+    methodCombo->setToolTip("Üreteç: Stres Testi sekmesindeki üreteç n argümanıyla çalıştırılır "
+                            "ve çıktısı programın girdisi olur");
+
+    parameterEdit = new QLineEdit("{n}");
+    parameterEdit->setToolTip("Argüman şablonu ({n} boyutla değişir) veya ortam değişkeni adı");
+    parameterEdit->setMaximumWidth(150);
+    connect(methodCombo, &QComboBox::currentTextChanged, this, [this](const QString &method) {
+        parameterEdit->setEnabled(method != "Üreteç");
+        parameterEdit->setText(method == "Ortam değişkeni" ? "N" : "{n}");
+    });
+
+    flagsEdit = new QLineEdit("-O2");
+    flagsEdit->setToolTip("C/C++ için derleyici bayrakları");
+    flagsEdit->setMaximumWidth(120);
+
+    startSpin = new QSpinBox();
+    startSpin->setRange(1, 1000000000);
+    startSpin->setValue(1000);
+    startSpin->setPrefix("n₀ = ");
+
+    factorSpin = new QSpinBox();
+    factorSpin->setRange(2, 10);
+    factorSpin->setValue(2);
+    factorSpin->setPrefix("× ");
+
+    stepsSpin = new QSpinBox();
+    stepsSpin->setRange(3, 30);
+    stepsSpin->setValue(8);
+    stepsSpin->setSuffix(" adım");
+
+    repeatSpin = new QSpinBox();
+    repeatSpin->setRange(1, 20);
+    repeatSpin->setValue(3);
+    repeatSpin->setSuffix(" tekrar");
+
+    startButton = new QPushButton("▶ Karmaşıklığı Ölç");
+    connect(startButton, &QPushButton::clicked, this, [this]() {
+        if (!isRunning())
+            emit runRequested();
+    });
+    stopButton = new QPushButton("■ Durdur");
+    stopButton->setEnabled(false);
+
+    bar->addWidget(methodCombo);
+    bar->addWidget(parameterEdit);
+    bar->addWidget(flagsEdit);
+    bar->addWidget(startSpin);
+    bar->addWidget(factorSpin);
+    bar->addWidget(stepsSpin);
+    bar->addWidget(repeatSpin);
+    bar->addWidget(startButton);
+    bar->addWidget(stopButton);
+    bar->addStretch();
+
+    statusLabel = new QLabel("Hazır");
+    statusLabel->setStyleSheet("QLabel { color: #cccccc; }");
+
+    table = new QTableWidget(0, 3);
+    table->setHorizontalHeaderLabels({"n", "Medyan (ms)", "Bellek (KB)"});
+    table->horizontalHeader()->setStretchLastSection(true);
+    table->verticalHeader()->setVisible(false);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                         "gridline-color: #454545; border: none; }"
+                         "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                         "border: none; padding: 3px; }");
+
+    timePlot = new PlotWidget();
+    timePlot->setTitle("Süre");
+    timePlot->setAxisLabels("n", "ms");
+    timePlot->setLogScale(true, true);
+
+    memoryPlot = new PlotWidget();
+    memoryPlot->setTitle("Bellek");
+    memoryPlot->setAxisLabels("n", "KB");
+    memoryPlot->setLogScale(true, true);
+
+    QSplitter *splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(table);
+    splitter->addWidget(timePlot);
+    splitter->addWidget(memoryPlot);
+    splitter->setSizes({300, 450, 450});
+
+    layout->addLayout(bar);
+    layout->addWidget(statusLabel);
+    layout->addWidget(splitter);
+
+    runner = new BenchmarkRunner(this);
+    connect(runner, &BenchmarkRunner::jobFinished, this, &ComplexityPanel::onJobFinished);
+    connect(runner, &BenchmarkRunner::allFinished, this, &ComplexityPanel::onAllFinished);
+    connect(runner, &BenchmarkRunner::progress, this, [this](int done, int total) {
+        statusLabel->setText(QString("Ölçülüyor: %1/%2").arg(done).arg(total));
+    });
+    connect(stopButton, &QPushButton::clicked, this, [this]() {
+        generating = false;
+        if (generatorProcess)
+            generatorProcess->kill();
+        runner->cancel();
+        setRunning(false);
+    });
+}
+
+QStringList ComplexityPanel::buildFlags() const {
+    return BuildPipeline::splitFlags(flagsEdit->text());
+}
+
+bool ComplexityPanel::usesGenerator() const {
+    return methodCombo->currentText() == "Üreteç";
+}
+
+bool ComplexityPanel::isRunning() const {
+    return generating || runner->isRunning();
+}
+
+void ComplexityPanel::showError(const QString &message) {
+    statusLabel->setText(message);
+}
+
+void ComplexityPanel::setRunning(bool running) {
+    startButton->setEnabled(!running);
+    stopButton->setEnabled(running);
+}
+
+QVector<qint64> ComplexityPanel::sizes() const {
+    QVector<qint64> result;
+    qint64 n = startSpin->value();
+    qint64 factor = factorSpin->value();
+    for (int i = 0; i < stepsSpin->value(); ++i) {
+        result.append(n);
+        if (n > maxSize / factor)
+            break;
+        n *= factor;
+    }
+    return result;
+}
+
+void ComplexityPanel::start(const RunTarget &runTarget, const RunTarget &generatorTarget,
+                            const QString &directory) {
+    if (isRunning())
+        return;
+
+    target = runTarget;
+    generator = generatorTarget;
+    runDir = directory;
+    steps = sizes();
+    times.clear();
+    memory.clear();
+    failed = false;
+    table->setRowCount(0);
+    timePlot->clear();
+    memoryPlot->clear();
+    setRunning(true);
+
+    if (usesGenerator()) {
+        generating = true;
+        generateInput(0);
+    } else {
+        startBenchmarks();
+    }
+}
+
+void ComplexityPanel::generateInput(int step) {
+    if (!generating)
+        return;
+    if (step >= steps.size()) {
+        generating = false;
+        startBenchmarks();
+        return;
+    }
+
+    statusLabel->setText(QString("Girdi üretiliyor: n = %1").arg(steps[step]));
+    QProcess *process = new QProcess(this);
+    generatorProcess = process;
+    process->setStandardInputFile(QProcess::nullDevice());
+    process->setStandardOutputFile(QDir(runDir).filePath(QString("input-%1.txt").arg(step)));
+
+    // Same limit as the measured runs
+    QTimer *timeout = new QTimer(process);
+    timeout->setSingleShot(true);
+    connect(timeout, &QTimer::timeout, process, &QProcess::kill);
+
+    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            [this, process, timeout, step](int exitCode, QProcess::ExitStatus exitStatus) {
+        process->deleteLater();
+        if (!generating)
+            return;
+        if (!timeout->isActive()) {
+            generating = false;
+            setRunning(false);
+            statusLabel->setText(QString("Hata: üreteç n = %1 için %2 sn içinde bitmedi")
+                                     .arg(steps[step]).arg(runner->jobTimeoutMs() / 1000));
+            return;
+        }
+        if (exitStatus != QProcess::NormalExit || exitCode != 0) {
+            generating = false;
+            setRunning(false);
+            statusLabel->setText(QString("Hata: üreteç n = %1 için başarısız oldu").arg(steps[step]));
+            return;
+        }
+        generateInput(step + 1);
+    });
+    connect(process, &QProcess::errorOccurred, [this, process](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart)
+            return;
+        process->deleteLater();
+        generating = false;
+        setRunning(false);
+        statusLabel->setText("Hata: üreteç başlatılamadı");
+    });
+    process->start(generator.program, generator.arguments + QStringList(QString::number(steps[step])));
+    timeout->start(runner->jobTimeoutMs());
+}
+
+void ComplexityPanel::startBenchmarks() {
+    runner->reset(runDir);
+    QString method = methodCombo->currentText();
+
+    for (int step = 0; step < steps.size(); ++step) {
+        BenchmarkJob job;
+        job.target = target;
+        job.tag = step;
+        QString n = QString::number(steps[step]);
+        if (method == "Üreteç") {
+            job.inputFile = QDir(runDir).filePath(QString("input-%1.txt").arg(step));
+        } else if (method == "Ortam değişkeni") {
+            job.environment = QProcessEnvironment::systemEnvironment();
+            job.environment.insert(parameterEdit->text().trimmed(), n);
+        } else {
+            QString arguments = parameterEdit->text();
+            job.arguments = BuildPipeline::splitFlags(arguments.replace("{n}", n));
+        }
+        for (int i = 0; i < repeatSpin->value(); ++i)
+            runner->enqueue(job);
+    }
+    runner->start();
+}
+
+void ComplexityPanel::onJobFinished(int index, const RunStats &stats) {
+    qint64 n = steps.value(runner->job(index).tag);
+    if (!stats.valid || stats.exitCode != 0 || stats.signal != 0) {
+        failed = true;
+        statusLabel->setText(QString("Hata: n = %1 için çalıştırma başarısız (%2)").arg(n).arg(stats.summary()));
+        runner->cancel();
+        return;
+    }
+    times[n].append(stats.wallMs);
+    memory[n] = qMax(memory.value(n), stats.maxRssKb);
+}
+
+double ComplexityPanel::model(int kind, double n) {
+    double log = std::log2(qMax(2.0, n));
+    switch (kind) {
+    case 0: return 1;
+    case 1: return log;
+    case 2: return n;
+    case 3: return n * log;
+    case 4: return n * n;
+    default: return n * n * n;
+    }
+}
+
+QVector<ComplexityPanel::Fit> ComplexityPanel::fitModels(const QVector<double> &ns, const QVector<double> &ys) {
+    // y = constant + scale * f(n) by least squares; the constant absorbs process start-up.
+    // Errors are relative so small and large n weigh the same.
+    QVector<Fit> fits;
+    for (int kind = 0; kind < modelCount; ++kind) {
+        int count = ns.size();
+        double mx = 0, my = 0;
+        for (int i = 0; i < count; ++i) {
+            mx += model(kind, ns[i]);
+            my += ys[i];
+        }
+        mx /= count;
+        my /= count;
+
+        double sxy = 0, sxx = 0;
+        for (int i = 0; i < count; ++i) {
+            double dx = model(kind, ns[i]) - mx;
+            sxy += dx * (ys[i] - my);
+            sxx += dx * dx;
+        }
+
+        Fit fit;
+        fit.name = modelNames[kind];
+        fit.kind = kind;
+        fit.scale = sxx > 0 ? qMax(0.0, sxy / sxx) : 0;
+        fit.constant = my - fit.scale * mx;
+        for (int i = 0; i < count; ++i) {
+            double predicted = fit.constant + fit.scale * model(kind, ns[i]);
+            double relative = (ys[i] - predicted) / qMax(ys[i], 1e-9);
+            fit.error += relative * relative;
+        }
+        fits.append(fit);
+    }
+    std::sort(fits.begin(), fits.end(), [](const Fit &a, const Fit &b) { return a.error < b.error; });
+    return fits;
+}
+
+double ComplexityPanel::logLogSlope(const QVector<double> &ns, const QVector<double> &ys) {
+    int count = ns.size();
+    double mx = 0, my = 0;
+    for (int i = 0; i < count; ++i) {
+        mx += std::log(ns[i]);
+        my += std::log(qMax(ys[i], 1e-9));
+    }
+    mx /= count;
+    my /= count;
+    double sxy = 0, sxx = 0;
+    for (int i = 0; i < count; ++i) {
+        double dx = std::log(ns[i]) - mx;
+        sxy += dx * (std::log(qMax(ys[i], 1e-9)) - my);
+        sxx += dx * dx;
+    }
+    return sxx > 0 ? sxy / sxx : 0;
+}
+
+void ComplexityPanel::onAllFinished() {
+    setRunning(false);
+    if (failed || times.size() < 3) {
+        if (!failed)
+            statusLabel->setText("Durduruldu (en az 3 boyut gerekli)");
+        return;
+    }
+
+    QVector<double> ns, medians, peaks;
+    QVector<QPointF> timePoints, memoryPoints;
+    table->setRowCount(times.size());
+    int row = 0;
+    for (auto it = times.cbegin(); it != times.cend(); ++it, ++row) {
+        double median = BenchmarkRunner::median(it.value());
+        ns.append(it.key());
+        medians.append(median);
+        peaks.append(memory.value(it.key()));
+        timePoints.append(QPointF(it.key(), median));
+        memoryPoints.append(QPointF(it.key(), memory.value(it.key())));
+
+        table->setItem(row, 0, new QTableWidgetItem(QString::number(it.key())));
+        table->setItem(row, 1, new QTableWidgetItem(QString::number(median, 'f', 2)));
+        table->setItem(row, 2, new QTableWidgetItem(QString::number(memory.value(it.key()))));
+    }
+
+    QVector<Fit> timeFits = fitModels(ns, medians);
+    QVector<Fit> memoryFits = fitModels(ns, peaks);
+    const Fit &bestTime = timeFits.first();
+    const Fit &bestMemory = memoryFits.first();
+    QVector<QPointF> timeFitPoints, memoryFitPoints;
+    for (double n : ns) {
+        timeFitPoints.append(QPointF(n, bestTime.constant + bestTime.scale * model(bestTime.kind, n)));
+        memoryFitPoints.append(QPointF(n, bestMemory.constant + bestMemory.scale * model(bestMemory.kind, n)));
+    }
+
+    timePlot->clear();
+    timePlot->setPoints(timePlot->addSeries("Ölçülen", QColor(86, 156, 214)), timePoints);
+    timePlot->setPoints(timePlot->addSeries(bestTime.name, QColor(206, 145, 120), true), timeFitPoints);
+    memoryPlot->clear();
+    memoryPlot->setPoints(memoryPlot->addSeries("Ölçülen", QColor(78, 201, 176)), memoryPoints);
+    memoryPlot->setPoints(memoryPlot->addSeries(bestMemory.name, QColor(206, 145, 120), true), memoryFitPoints);
+
+    statusLabel->setText(QString("Süre: %1 (ikinci: %2, log-log eğimi %3) | Bellek: %4 (log-log eğimi %5)")
+                             .arg(bestTime.name)
+                             .arg(timeFits.value(1).name)
+                             .arg(logLogSlope(ns, medians), 0, 'f', 2)
+                             .arg(bestMemory.name)
+                             .arg(logLogSlope(ns, peaks), 0, 'f', 2));
+}
@@ -0,0 +1,85 @@
+#ifndef COMPLEXITYPANEL_H
+#define COMPLEXITYPANEL_H
+
+#include <QWidget>
+#include <QMap>
+#include <QPointer>
+#include <QVector>
+#include "buildpipeline.h"
+#include "runstats.h"
+
+class BenchmarkRunner;
+class PlotWidget;
+class QComboBox;
+class QLineEdit;
+class QSpinBox;
+class QPushButton;
+class QLabel;
+class QTableWidget;
+class QProcess;
+
+// Runs a program at geometrically growing input sizes and fits time and
+// peak memory against the usual complexity classes
+class ComplexityPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit ComplexityPanel(QWidget *parent = nullptr);
+
+    QStringList buildFlags() const;
+    bool usesGenerator() const;
+    void start(const RunTarget &target, const RunTarget &generator, const QString &runDir);
+    void showError(const QString &message);
+    bool isRunning() const;
+
+signals:
+    void runRequested();
+
+private slots:
+    void onJobFinished(int index, const RunStats &stats);
+    void onAllFinished();
+
+private:
+    struct Fit {
+        QString name;
+        int kind = 0;
+        double constant = 0;
+        double scale = 0;
+        double error = 0;
+    };
+
+    QVector<qint64> sizes() const;
+    void generateInput(int step);
+    void startBenchmarks();
+    void setRunning(bool running);
+    static double model(int kind, double n);
+    static QVector<Fit> fitModels(const QVector<double> &ns, const QVector<double> &ys);
+    static double logLogSlope(const QVector<double> &ns, const QVector<double> &ys);
+
+    QComboBox *methodCombo;
+    QLineEdit *parameterEdit;
+    QLineEdit *flagsEdit;
+    QSpinBox *startSpin;
+    QSpinBox *factorSpin;
+    QSpinBox *stepsSpin;
+    QSpinBox *repeatSpin;
+    QPushButton *startButton;
+    QPushButton *stopButton;
+    QLabel *statusLabel;
+    QTableWidget *table;
+    PlotWidget *timePlot;
+    PlotWidget *memoryPlot;
+
+    BenchmarkRunner *runner;
+    RunTarget target;
+    RunTarget generator;
+    QString runDir;
+    QVector<qint64> steps;
+    bool generating = false;
+    QPointer<QProcess> generatorProcess;
+    bool failed = false;
+    QMap<qint64, QVector<double>> times;
+    QMap<qint64, qint64> memory;
+};
+
+#endif // COMPLEXITYPANEL_H
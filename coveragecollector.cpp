@@ -0,0 +1,184 @@
+#include "coveragecollector.h"
+#include "buildpipeline.h"
+#include "languagebackend.h"
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QProcess>
+#include <QTimer>
+
+// A coverage run is one ordinary run, slower only by the counters
+static const int runTimeoutMs = 60000;
+
+CoverageCollector::CoverageCollector(QObject *parent) : QObject(parent) {
+}
+
+void CoverageCollector::fail(const QString &message) {
+    collecting = false;
+    emit failed(message);
+}
+
+void CoverageCollector::stop() {
+    if (!collecting)
+        return;
+    ++generation;
+    if (process)
+        process->kill();
+    fail("Kapsam toplama durduruldu");
+}
+
+void CoverageCollector::collect(BuildPipeline *pipeline, const QString &language, const QString &code,
+                                const QStringList &flags, const QString &inputFile, const QString &runDir) {
+    if (!BuildPipeline::isCompiled(language)) {
+        fail("Kapsam yalnızca C ve C++ için kullanılabilir");
+        return;
+    }
+    // A newer request replaces the one in flight
+    int current = ++generation;
+    collecting = true;
+    if (process)
+        process->kill();
+
+    // LTO would leave the counters to the link step
+    QStringList compileFlags;
+    for (const QString &flag : flags) {
+        if (!flag.startsWith("-flto"))
+            compileFlags << flag;
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(compileFlags.join('\n').toUtf8());
+    QString sourceKey = BuildPipeline::sourceKey(language, code);
+    QString dir = QDir(pipeline->rootDir()).filePath("coverage-" + sourceKey +
+                                                     QString::fromLatin1(hash.result().toHex().left(8)));
+    QString sourceName = "main" + BuildPipeline::sourceSuffix(language);
+    // Started the way a normal run starts the program
+    RunTarget target = LanguageBackend::find(language)->runTarget(BuildPipeline::compiler(language),
+                                                                  dir + "/" + sourceName, dir + "/program");
+    if (QFileInfo::exists(target.program)) {
+        runProgram(pipeline, target, sourceName, sourceKey, inputFile, runDir);
+        return;
+    }
+
+    QDir().mkpath(dir);
+    QFile file(dir + "/" + sourceName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        fail("Hata: Dosya oluşturulamadı!");
+        return;
+    }
+    file.write(code.toUtf8());
+    file.close();
+
+    // Compiled and linked separately so the counters land in main.gcda
+    QString compiler = BuildPipeline::compiler(language);
+    QString object = dir + "/main.o";
+    QStringList compileArgs;
+    compileArgs << "-c" << file.fileName() << compileFlags << "--coverage" << "-o" << object;
+    pipeline->runStep(compiler, compileArgs, [=](bool ok, const QString &log) {
+        if (current != generation)
+            return;
+        if (!ok) {
+            fail("✗ Kapsam derlemesi başarısız:\n" + log);
+            return;
+        }
+        QStringList linkArgs;
+        linkArgs << object << compileFlags << "--coverage" << "-o" << target.program;
+        pipeline->runStep(compiler, linkArgs, [=](bool ok, const QString &log) {
+            if (current != generation)
+                return;
+            if (!ok) {
+                fail("✗ Kapsam derlemesi başarısız:\n" + log);
+                return;
+            }
+            runProgram(pipeline, target, sourceName, sourceKey, inputFile, runDir);
+        });
+    });
+}
+
+void CoverageCollector::runProgram(BuildPipeline *pipeline, const RunTarget &target, const QString &sourceName,
+                                   const QString &sourceKey, const QString &inputFile, const QString &runDir) {
+    QString dir = target.buildDir;
+    // Counters accumulate across runs, each collection starts from zero
+    QFile::remove(dir + "/main.gcda");
+
+    QProcess *program = new QProcess(this);
+    program->setStandardInputFile(inputFile.isEmpty() ? QProcess::nullDevice() : inputFile);
+    program->setStandardOutputFile(runDir + "/program.out");
+    program->setStandardErrorFile(runDir + "/program.err");
+    program->setWorkingDirectory(runDir);
+    process = program;
+
+    QTimer *timeout = new QTimer(program);
+    timeout->setSingleShot(true);
+    connect(timeout, &QTimer::timeout, program, &QProcess::kill);
+
+    int current = generation;
+    connect(program, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            [this, pipeline, program, timeout, current, dir, sourceName, sourceKey]() {
+        program->deleteLater();
+        if (current != generation)
+            return;
+        if (!timeout->isActive()) {
+            fail(QString("Kapsam çalıştırması %1 sn sonra durduruldu").arg(runTimeoutMs / 1000));
+            return;
+        }
+        // Written by an atexit handler, a crash or _exit leaves nothing behind
+        if (!QFileInfo::exists(dir + "/main.gcda")) {
+            fail("Kapsam verisi yok, program normal şekilde sonlanmadı");
+            return;
+        }
+        pipeline->runStep("gcov", {"--json-format", "--stdout", dir + "/main.o"},
+                          [this, current, sourceName, sourceKey](bool ok, const QString &output) {
+            if (current != generation)
+                return;
+            LineHeat heat = parse(output, sourceName);
+            if (!ok || heat.counts.isEmpty()) {
+                fail("gcov başarısız:\n" + output.left(2000));
+                return;
+            }
+            collecting = false;
+            emit coverageReady(sourceKey, heat);
+        });
+    });
+    connect(program, &QProcess::errorOccurred, [this, program, current](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart)
+            return;
+        program->deleteLater();
+        if (current == generation)
+            fail("Hata: Program başlatılamadı!");
+    });
+
+    program->start(target.program, target.arguments);
+    timeout->start(runTimeoutMs);
+}
+
+LineHeat CoverageCollector::parse(const QString &json, const QString &sourceName) {
+    LineHeat heat;
+    heat.unit = "kez çalıştı";
+
+    // Warnings share the channel with the JSON document
+    int begin = json.indexOf('{');
+    int end = json.lastIndexOf('}');
+    if (begin < 0 || end < begin)
+        return heat;
+    QJsonDocument document = QJsonDocument::fromJson(json.mid(begin, end - begin + 1).toUtf8());
+
+    // {"files": [{"file": "main.cpp", "lines": [{"line_number": 3, "count": 40}, ...]}]}
+    const QJsonArray files = document.object().value("files").toArray();
+    for (const QJsonValue &file : files) {
+        QJsonObject object = file.toObject();
+        if (QFileInfo(object.value("file").toString()).fileName() != sourceName)
+            continue;
+        const QJsonArray lines = object.value("lines").toArray();
+        for (const QJsonValue &line : lines) {
+            QJsonObject entry = line.toObject();
+            // Template instances report the same line once each
+            heat.counts[entry.value("line_number").toInt()] += qint64(entry.value("count").toDouble());
+        }
+    }
+    return heat;
+}
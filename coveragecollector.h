@@ -0,0 +1,42 @@
+#ifndef COVERAGECOLLECTOR_H
+#define COVERAGECOLLECTOR_H
+
+#include <QObject>
+#include <QPointer>
+#include "codeeditor.h"
+
+class BuildPipeline;
+class QProcess;
+struct RunTarget;
+
+// Runs the buffer once from a --coverage build and reads per-line
+// execution counts back with gcov's JSON output
+class CoverageCollector : public QObject {
+    Q_OBJECT
+
+public:
+    explicit CoverageCollector(QObject *parent = nullptr);
+
+    void collect(BuildPipeline *pipeline, const QString &language, const QString &code,
+                 const QStringList &flags, const QString &inputFile, const QString &runDir);
+
+    // Kills the instrumented run and drops whatever is still pending
+    void stop();
+
+    static LineHeat parse(const QString &json, const QString &sourceName);
+
+signals:
+    void coverageReady(const QString &sourceKey, const LineHeat &heat);
+    void failed(const QString &message);
+
+private:
+    void runProgram(BuildPipeline *pipeline, const RunTarget &target, const QString &sourceName,
+                    const QString &sourceKey, const QString &inputFile, const QString &runDir);
+    void fail(const QString &message);
+
+    QPointer<QProcess> process;
+    int generation = 0;
+    bool collecting = false;
+};
+
+#endif // COVERAGECOLLECTOR_H
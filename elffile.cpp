@@ -0,0 +1,202 @@
+#include "elffile.h"
+#include <QFile>
+#include <QtEndian>
+
+// Field offsets and constants from the ELF64 specification
+static const int headerSize = 64;
+static const int sectionHeaderSize = 64;
+static const int programHeaderSize = 56;
+static const int symbolSize = 24;
+
+static const quint32 programInterpreter = 3;
+static const quint32 sectionSymtab = 2;
+static const quint32 sectionNobits = 8;
+static const quint32 sectionInitArray = 14;
+static const quint32 sectionDynsym = 11;
+static const quint64 flagWrite = 0x1;
+static const quint64 flagAlloc = 0x2;
+static const quint64 flagExecute = 0x4;
+static const int symbolObject = 1;
+static const int symbolFunction = 2;
+
+bool ElfSection::isAllocated() const {
+    return flags & flagAlloc;
+}
+
+bool ElfSection::isCode() const {
+    return isAllocated() && (flags & flagExecute);
+}
+
+bool ElfSection::isWritable() const {
+    return isAllocated() && (flags & flagWrite);
+}
+
+bool ElfSection::occupiesFile() const {
+    return type != sectionNobits;
+}
+
+// Bounds-checked little-endian reads; anything past the end reads as zero
+// and sets truncated
+template <typename T>
+static T field(const QByteArray &data, quint64 offset, bool &truncated) {
+    if (offset > quint64(data.size()) || quint64(data.size()) - offset < sizeof(T)) {
+        truncated = true;
+        return 0;
+    }
+    return qFromLittleEndian<T>(reinterpret_cast<const uchar *>(data.constData() + offset));
+}
+
+static QString stringAt(const QByteArray &data, quint64 offset, quint64 end) {
+    end = qMin(end, quint64(data.size()));
+    if (offset >= end)
+        return QString();
+    const char *start = data.constData() + offset;
+    return QString::fromUtf8(start, int(qstrnlen(start, uint(end - offset))));
+}
+
+ElfFile ElfFile::load(const QString &path) {
+    ElfFile elf;
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        elf.error = "Dosya açılamadı: " + path;
+        return elf;
+    }
+    const QByteArray data = file.readAll();
+    elf.fileSize = data.size();
+
+    if (data.size() < headerSize || !data.startsWith("\x7f" "ELF")) {
+        elf.error = "ELF dosyası değil";
+        return elf;
+    }
+    if (data[4] != 2 || data[5] != 1) {
+        elf.error = "Yalnızca 64 bit little-endian ELF destekleniyor";
+        return elf;
+    }
+
+    bool truncated = false;
+    quint64 programOffset = field<quint64>(data, 32, truncated);
+    quint64 sectionOffset = field<quint64>(data, 40, truncated);
+    quint16 programCount = field<quint16>(data, 56, truncated);
+    quint16 sectionCount = field<quint16>(data, 60, truncated);
+    quint16 namesIndex = field<quint16>(data, 62, truncated);
+
+    for (int i = 0; i < programCount; ++i) {
+        if (field<quint32>(data, programOffset + quint64(i) * programHeaderSize, truncated) == programInterpreter)
+            elf.dynamic = true;
+    }
+
+    struct RawSection {
+        quint64 offset;
+        quint32 link;
+    };
+    QVector<RawSection> raw;
+    for (int i = 0; i < sectionCount; ++i) {
+        quint64 header = sectionOffset + quint64(i) * sectionHeaderSize;
+        ElfSection section;
+        section.type = field<quint32>(data, header + 4, truncated);
+        section.flags = field<quint64>(data, header + 8, truncated);
+        section.address = field<quint64>(data, header + 16, truncated);
+        section.size = field<quint64>(data, header + 32, truncated);
+        elf.sections.append(section);
+        raw.append(RawSection{field<quint64>(data, header + 24, truncated), field<quint32>(data, header + 40, truncated)});
+    }
+    if (truncated) {
+        elf.error = "ELF başlıkları eksik, dosya kesilmiş olabilir";
+        return elf;
+    }
+
+    if (namesIndex < sectionCount) {
+        quint64 base = raw[namesIndex].offset;
+        quint64 end = base + elf.sections[namesIndex].size;
+        for (int i = 0; i < sectionCount; ++i) {
+            quint32 name = field<quint32>(data, sectionOffset + quint64(i) * sectionHeaderSize, truncated);
+            elf.sections[i].name = stringAt(data, base + name, end);
+        }
+    }
+
+    // Prefer the full symbol table, a stripped binary only keeps the
+    // dynamic one
+    int symbolTable = -1;
+    for (int i = 0; i < sectionCount; ++i) {
+        if (elf.sections[i].type == sectionSymtab)
+            symbolTable = i;
+    }
+    if (symbolTable < 0) {
+        elf.stripped = true;
+        for (int i = 0; i < sectionCount; ++i) {
+            if (elf.sections[i].type == sectionDynsym)
+                symbolTable = i;
+        }
+    }
+
+    if (symbolTable >= 0 && raw[symbolTable].link < quint32(sectionCount)) {
+        const RawSection &strings = raw[raw[symbolTable].link];
+        quint64 stringsEnd = strings.offset + elf.sections[raw[symbolTable].link].size;
+        quint64 count = elf.sections[symbolTable].size / symbolSize;
+        for (quint64 i = 1; i < count; ++i) {
+            quint64 entry = raw[symbolTable].offset + i * symbolSize;
+            quint8 info = field<quint8>(data, entry + 4, truncated);
+            int type = info & 0xf;
+            if (type != symbolFunction && type != symbolObject)
+                continue;
+            quint16 index = field<quint16>(data, entry + 6, truncated);
+            ElfSymbol symbol;
+            symbol.name = stringAt(data, strings.offset + field<quint32>(data, entry, truncated), stringsEnd);
+            symbol.address = field<quint64>(data, entry + 8, truncated);
+            symbol.size = field<quint64>(data, entry + 16, truncated);
+            symbol.function = type == symbolFunction;
+            symbol.local = (info >> 4) == 0;
+            if (index > 0 && index < sectionCount)
+                symbol.section = elf.sections[index].name;
+            if (!symbol.name.isEmpty())
+                elf.symbols.append(symbol);
+        }
+    }
+
+    for (int i = 0; i < sectionCount; ++i) {
+        if (elf.sections[i].type != sectionInitArray)
+            continue;
+        quint64 count = elf.sections[i].size / sizeof(quint64);
+        for (quint64 j = 0; j < count; ++j)
+            elf.initializers.append(field<quint64>(data, raw[i].offset + j * sizeof(quint64), truncated));
+    }
+
+    elf.valid = !truncated;
+    if (!elf.valid)
+        elf.error = "ELF tabloları dosyanın dışına taşıyor";
+    return elf;
+}
+
+quint64 ElfFile::sectionSize(const QString &name) const {
+    for (const ElfSection &section : sections) {
+        if (section.name == name)
+            return section.size;
+    }
+    return 0;
+}
+
+quint64 ElfFile::codeSize() const {
+    quint64 total = 0;
+    for (const ElfSection &section : sections) {
+        if (section.isCode())
+            total += section.size;
+    }
+    return total;
+}
+
+quint64 ElfFile::dataSize() const {
+    quint64 total = 0;
+    for (const ElfSection &section : sections) {
+        if (section.isWritable())
+            total += section.size;
+    }
+    return total;
+}
+
+QString ElfFile::functionAt(quint64 address) const {
+    for (const ElfSymbol &symbol : symbols) {
+        if (symbol.function && symbol.address == address)
+            return symbol.name;
+    }
+    return QString();
+}
@@ -0,0 +1,52 @@
+#ifndef ELFFILE_H
+#define ELFFILE_H
+
+#include <QString>
+#include <QVector>
+
+struct ElfSection {
+    QString name;
+    quint32 type = 0;
+    quint64 flags = 0;
+    quint64 address = 0;
+    quint64 size = 0;
+
+    bool isAllocated() const;
+    bool isCode() const;
+    bool isWritable() const;
+    // .bss and friends take memory at run time but no bytes in the file
+    bool occupiesFile() const;
+};
+
+struct ElfSymbol {
+    QString name;       // as stored, C++ names are still mangled
+    QString section;
+    quint64 address = 0;
+    quint64 size = 0;
+    bool function = false;
+    bool local = false;
+};
+
+// Just enough of a 64-bit little-endian ELF reader for size reports:
+// section headers, the symbol table and the .init_array entries. The file
+// is read directly instead of going through readelf/nm, so nothing beyond
+// the compiler has to be installed.
+struct ElfFile {
+    bool valid = false;
+    QString error;
+    qint64 fileSize = 0;
+    bool dynamic = false;   // has a program interpreter
+    bool stripped = false;  // no .symtab, symbols come from .dynsym
+    QVector<ElfSection> sections;
+    QVector<ElfSymbol> symbols;
+    QVector<quint64> initializers;
+
+    static ElfFile load(const QString &path);
+    quint64 sectionSize(const QString &name) const;
+    quint64 codeSize() const;
+    quint64 dataSize() const;
+    // Name of the function starting at address, empty when unknown
+    QString functionAt(quint64 address) const;
+};
+
+#endif // ELFFILE_H
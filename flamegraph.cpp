@@ -0,0 +1,146 @@
+#include "flamegraph.h"
+#include <QHelpEvent>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QToolTip>
+
+FlameGraph::FlameGraph(QWidget *parent) : QWidget(parent) {
+    setMinimumSize(240, 160);
+    setMouseTracking(true);
+}
+
+void FlameGraph::setNodes(const QVector<FlameNode> &newNodes) {
+    nodes = newNodes;
+    zoomRoot = 0;
+
+    int maxDepth = 0;
+    for (int i = 0; i < nodes.size(); ++i)
+        maxDepth = qMax(maxDepth, depthOf(i));
+    setMinimumHeight((maxDepth + 2) * rowHeight);
+    layoutBoxes();
+    update();
+}
+
+void FlameGraph::clear() {
+    setNodes(QVector<FlameNode>());
+}
+
+int FlameGraph::depthOf(int node) const {
+    int depth = 0;
+    for (int i = nodes[node].parent; i >= 0; i = nodes[i].parent)
+        ++depth;
+    return depth;
+}
+
+void FlameGraph::layoutBoxes() {
+    boxes.clear();
+    ancestorCount = 0;
+    if (nodes.isEmpty() || nodes.first().total == 0)
+        return;
+
+    // Ancestors of the zoomed frame stay visible as full-width bars below it
+    int depth = depthOf(zoomRoot);
+    ancestorCount = depth;
+    for (int i = nodes[zoomRoot].parent, d = depth - 1; i >= 0; i = nodes[i].parent, --d) {
+        Box box;
+        box.rect = QRectF(0, height() - (d + 1) * rowHeight, width(), rowHeight - 1);
+        box.node = i;
+        boxes.append(box);
+    }
+    place(zoomRoot, 0, width(), depth);
+}
+
+void FlameGraph::place(int node, double x, double span, int depth) {
+    if (span < 1.0)
+        return;
+
+    Box box;
+    box.rect = QRectF(x, height() - (depth + 1) * rowHeight, span, rowHeight - 1);
+    box.node = node;
+    boxes.append(box);
+
+    const FlameNode &current = nodes[node];
+    double childX = x;
+    for (int child : current.children) {
+        double childWidth = span * nodes[child].total / current.total;
+        place(child, childX, childWidth, depth + 1);
+        childX += childWidth;
+    }
+}
+
+void FlameGraph::paintEvent(QPaintEvent *event) {
+    Q_UNUSED(event);
+    layoutBoxes();
+
+    QPainter painter(this);
+    painter.fillRect(rect(), QColor(30, 30, 30));
+    if (boxes.isEmpty()) {
+        painter.setPen(QColor(128, 128, 128));
+        painter.drawText(rect(), Qt::AlignCenter, "Profil verisi yok");
+        return;
+    }
+
+    QFontMetrics metrics(font());
+    for (int i = 0; i < boxes.size(); ++i) {
+        const Box &box = boxes[i];
+        const FlameNode &node = nodes[box.node];
+
+        // Warm colors for the buffer's own code, cool ones for libraries
+        uint hash = qHash(node.name);
+        QColor color = node.line > 0
+            ? QColor::fromHsv(int(10 + hash % 40), 170 + int(hash % 60), 200 + int(hash % 40))
+            : QColor::fromHsv(int(200 + hash % 30), 60 + int(hash % 40), 120 + int(hash % 40));
+        if (i < ancestorCount)
+            color = color.darker(160);
+
+        painter.fillRect(box.rect, color);
+        if (box.rect.width() > 30) {
+            painter.setPen(QColor(20, 20, 20));
+            QRectF text = box.rect.adjusted(3, 0, -3, 0);
+            painter.drawText(text, Qt::AlignVCenter | Qt::AlignLeft,
+                             metrics.elidedText(node.name, Qt::ElideRight, int(text.width())));
+        }
+    }
+}
+
+int FlameGraph::nodeAt(const QPoint &pos) const {
+    for (const Box &box : boxes) {
+        if (box.rect.contains(pos))
+            return box.node;
+    }
+    return -1;
+}
+
+void FlameGraph::mousePressEvent(QMouseEvent *event) {
+    if (event->button() != Qt::LeftButton)
+        return;
+    int node = nodeAt(event->pos());
+    zoomRoot = node >= 0 ? node : 0;
+    update();
+}
+
+void FlameGraph::mouseDoubleClickEvent(QMouseEvent *event) {
+    int node = nodeAt(event->pos());
+    if (node >= 0 && nodes[node].line > 0)
+        emit lineActivated(nodes[node].line);
+}
+
+bool FlameGraph::event(QEvent *event) {
+    if (event->type() == QEvent::ToolTip) {
+        QHelpEvent *help = static_cast<QHelpEvent *>(event);
+        int node = nodeAt(help->pos());
+        if (node < 0 || nodes.isEmpty()) {
+            QToolTip::hideText();
+            return true;
+        }
+        const FlameNode &frame = nodes[node];
+        double percent = 100.0 * frame.total / nodes.first().total;
+        QString text = QString("%1\n%2 örnek (%3%), kendisi %4")
+                           .arg(frame.name).arg(frame.total).arg(percent, 0, 'f', 1).arg(frame.self);
+        if (frame.line > 0)
+            text += QString("\nSatır %1 (çift tıkla)").arg(frame.line);
+        QToolTip::showText(help->globalPos(), text, this);
+        return true;
+    }
+    return QWidget::event(event);
+}
@@ -0,0 +1,55 @@
+#ifndef FLAMEGRAPH_H
+#define FLAMEGRAPH_H
+
+#include <QWidget>
+#include <QVector>
+
+struct FlameNode {
+    QString name;
+    int line = 0;           // line in the buffer, 0 when outside it
+    qint64 total = 0;
+    qint64 self = 0;
+    int parent = -1;
+    QVector<int> children;
+};
+
+// Flame graph of sampled call stacks, root at the bottom. Click a frame to
+// zoom into it, click below to zoom back out, double-click to jump to source.
+class FlameGraph : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit FlameGraph(QWidget *parent = nullptr);
+
+    // Node 0 is the root
+    void setNodes(const QVector<FlameNode> &nodes);
+    void clear();
+
+signals:
+    void lineActivated(int line);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseDoubleClickEvent(QMouseEvent *event) override;
+    bool event(QEvent *event) override;
+
+private:
+    struct Box {
+        QRectF rect;
+        int node;
+    };
+
+    void layoutBoxes();
+    void place(int node, double x, double span, int depth);
+    int nodeAt(const QPoint &pos) const;
+    int depthOf(int node) const;
+
+    QVector<FlameNode> nodes;
+    QVector<Box> boxes;
+    int zoomRoot = 0;
+    int ancestorCount = 0;
+    int rowHeight = 18;
+};
+
+#endif // FLAMEGRAPH_H
@@ -0,0 +1,115 @@
+#include "forkserver.h"
+#include <QProcess>
+#include <QUuid>
+
+ForkServer::ForkServer(QObject *parent) : QObject(parent) {
+    runMarker = "\x1e" + QUuid::createUuid().toByteArray(QUuid::WithoutBraces) + ":";
+}
+
+ForkServer::~ForkServer() {
+    if (host) {
+        host->disconnect(this);
+        host->kill();
+        host->waitForFinished(1000);
+    }
+}
+
+void ForkServer::launch(const QString &program, const QStringList &arguments) {
+    if (host && program == hostProgram && arguments == hostArguments)
+        return;
+    shutdown();
+
+    QProcess *process = new QProcess(this);
+    host = process;
+    hostProgram = program;
+    hostArguments = arguments;
+    connect(process, &QProcess::readyReadStandardOutput, this, [this]() { consume(StandardOutput); });
+    connect(process, &QProcess::readyReadStandardError, this, [this]() { consume(StandardError); });
+    connect(process, &QProcess::errorOccurred, this, [this, process, program](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart)
+            return;
+        process->deleteLater();
+        if (running) {
+            running = false;
+            emit failed("Hata: " + program + " başlatılamadı!");
+        }
+    });
+    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished), this, [this, process]() {
+        process->deleteLater();
+        if (running) {
+            running = false;
+            emit failed("Hata: Yardımcı süreç beklenmedik şekilde sonlandı!");
+        }
+    });
+
+    pending[StandardOutput].clear();
+    pending[StandardError].clear();
+    process->start(program, arguments);
+}
+
+void ForkServer::send(const QString &payload, const QString &inputFile, const QString &statsFile) {
+    if (!host) {
+        emit failed("Hata: Yardımcı süreç çalışmıyor!");
+        return;
+    }
+
+    running = true;
+    done[StandardOutput] = done[StandardError] = false;
+    exitCode = 0;
+    QString request = payload + '\t' + inputFile + '\t' + statsFile + '\n';
+    host->write(request.toUtf8());
+}
+
+void ForkServer::shutdown() {
+    if (host) {
+        QProcess *process = host;
+        host = nullptr;
+        process->disconnect(this);
+        process->kill();
+        process->waitForFinished(1000);
+        process->deleteLater();
+    }
+    if (running) {
+        running = false;
+        emit failed("Çalışma durduruldu, yardımcı süreç kapatıldı");
+    }
+}
+
+void ForkServer::consume(int stream) {
+    if (!host)
+        return;
+    QByteArray &buffer = pending[stream];
+    buffer += stream == StandardOutput ? host->readAllStandardOutput() : host->readAllStandardError();
+    // Anything the helper prints between runs is dropped
+    if (!running || done[stream]) {
+        buffer.clear();
+        return;
+    }
+
+    int at = buffer.indexOf(runMarker);
+    if (at >= 0) {
+        int end = buffer.indexOf('\n', at);
+        if (end < 0)
+            return;
+        if (at > 0)
+            emit output(stream, buffer.left(at));
+        if (stream == StandardOutput)
+            exitCode = buffer.mid(at + runMarker.size(), end - at - runMarker.size()).toInt();
+        buffer.clear();
+        done[stream] = true;
+        if (done[StandardOutput] && done[StandardError]) {
+            running = false;
+            emit finished(exitCode);
+        }
+        return;
+    }
+
+    // Hold back a tail that could be the start of a marker split across reads
+    int keep = 0;
+    int cut = buffer.lastIndexOf('\x1e');
+    if (cut >= 0 && buffer.size() - cut < runMarker.size() && runMarker.startsWith(buffer.mid(cut)))
+        keep = buffer.size() - cut;
+    if (buffer.size() > keep)
+        emit output(stream, buffer.left(buffer.size() - keep));
+    buffer = buffer.right(keep);
+}
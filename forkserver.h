@@ -0,0 +1,56 @@
+#ifndef FORKSERVER_H
+#define FORKSERVER_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QPointer>
+#include <QStringList>
+
+class QProcess;
+
+// Client side of a long-lived helper that forks a child per run, so the
+// expensive state lives in the helper and every run still gets its own
+// process (warm Python, hot reload). Requests are "payload\tinput\tstats"
+// lines on the helper's stdin. Program output comes back on its stdout and
+// stderr, and after each run the helper writes marker() followed by the
+// exit code and a newline to both streams; that is how the end of a run is
+// found in the byte stream.
+class ForkServer : public QObject {
+    Q_OBJECT
+
+public:
+    enum Stream { StandardOutput, StandardError };
+
+    explicit ForkServer(QObject *parent = nullptr);
+    ~ForkServer() override;
+
+    // Kills the helper; a run in progress ends with failed()
+    void shutdown();
+    bool isStarted() const { return !host.isNull(); }
+    bool isRunning() const { return running; }
+
+signals:
+    void output(int stream, const QByteArray &data);
+    void finished(int exitCode);
+    void failed(const QString &message);
+
+protected:
+    // Restarts the helper when the command line differs from the running one
+    void launch(const QString &program, const QStringList &arguments);
+    void send(const QString &payload, const QString &inputFile, const QString &statsFile);
+    QByteArray marker() const { return runMarker; }
+
+private:
+    void consume(int stream);
+
+    QPointer<QProcess> host;
+    QString hostProgram;
+    QStringList hostArguments;
+    QByteArray runMarker;
+    QByteArray pending[2];
+    bool done[2] = {false, false};
+    int exitCode = 0;
+    bool running = false;
+};
+
+#endif // FORKSERVER_H
@@ -0,0 +1,488 @@
+#include "heappanel.h"
+#include <QDir>
+#include <QFile>
+#include <QHeaderView>
+#include <QLabel>
+#include <QSet>
+#include <QTableWidget>
+#include <QVBoxLayout>
+
+// Preloaded into the program. Every allocation is charged to the first few
+// frames of the program itself (allocator and C++ runtime frames skipped);
+// live blocks sit in a pointer table so frees can be charged back and the
+// peak live heap tracked. The report is written at exit:
+// "total count bytes frees peak live untracked", then one line per call
+// stack: "count bytes live frame...".
+static const char interposerSource[] = R"HEAP(
+#define _GNU_SOURCE
+#include <errno.h>
+#include <link.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <unwind.h>
+
+/* glibc's own entry points, so no dlsym bootstrap is needed */
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *pointer, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void __libc_free(void *pointer);
+
+#define DEPTH 6
+#define SITES (1 << 16)
+#define LIVE_BITS 22
+#define LIVE (1u << LIVE_BITS)
+
+struct site {
+    uintptr_t frames[DEPTH];
+    uint64_t count;
+    uint64_t bytes;
+    uint64_t live;
+    int used;
+};
+
+struct block {
+    uintptr_t pointer;
+    uint64_t size;
+    uint32_t site;
+};
+
+static struct site *sites;
+static struct block *blocks;
+static uint64_t total_count, total_bytes, free_count, live_bytes, peak_bytes, untracked;
+static uintptr_t exe_start[16], exe_end[16], exe_bias;
+static int exe_segments;
+static int enabled;
+static int lock;
+static char output[4096];
+static __thread int busy __attribute__((tls_model("initial-exec")));
+
+static void acquire(void) {
+    while (__atomic_exchange_n(&lock, 1, __ATOMIC_ACQUIRE))
+        ;
+}
+
+static void release(void) {
+    __atomic_store_n(&lock, 0, __ATOMIC_RELEASE);
+}
+
+static int inside(uintptr_t address) {
+    for (int i = 0; i < exe_segments; ++i) {
+        if (address >= exe_start[i] && address < exe_end[i])
+            return 1;
+    }
+    return 0;
+}
+
+struct walk {
+    uintptr_t frames[DEPTH];
+    int depth;
+};
+
+static _Unwind_Reason_Code collect_frame(struct _Unwind_Context *context, void *data) {
+    struct walk *walk = (struct walk *)data;
+    uintptr_t ip = (uintptr_t)_Unwind_GetIP(context);
+    /* Only the program's own frames, the allocator and the C++ runtime are noise */
+    if (inside(ip))
+        walk->frames[walk->depth++] = ip - exe_bias;
+    return walk->depth < DEPTH ? _URC_NO_REASON : _URC_END_OF_STACK;
+}
+
+static uint32_t hash_pointer(uintptr_t pointer) {
+    return (uint32_t)(((uint64_t)pointer * 0x9E3779B97F4A7C15ull) >> (64 - LIVE_BITS));
+}
+
+static void record_alloc(void *pointer, size_t size) {
+    if (!enabled || !pointer || busy)
+        return;
+    busy = 1;
+    struct walk walk;
+    memset(&walk, 0, sizeof walk);
+    _Unwind_Backtrace(collect_frame, &walk);
+
+    uint64_t key = 1469598103934665603ull;
+    for (int i = 0; i < DEPTH; ++i)
+        key = (key ^ walk.frames[i]) * 1099511628211ull;
+
+    acquire();
+    uint32_t index = (uint32_t)(key & (SITES - 1));
+    for (int probe = 0; probe < SITES; ++probe, index = (index + 1) & (SITES - 1)) {
+        if (!sites[index].used) {
+            sites[index].used = 1;
+            memcpy(sites[index].frames, walk.frames, sizeof walk.frames);
+            break;
+        }
+        if (!memcmp(sites[index].frames, walk.frames, sizeof walk.frames))
+            break;
+    }
+    struct site *site = &sites[index];
+    site->count++;
+    site->bytes += size;
+    site->live += size;
+    total_count++;
+    total_bytes += size;
+    live_bytes += size;
+    if (live_bytes > peak_bytes)
+        peak_bytes = live_bytes;
+
+    /* Linear probing; a full table only loses the live/peak attribution */
+    uint32_t slot = hash_pointer((uintptr_t)pointer);
+    int placed = 0;
+    for (uint32_t probe = 0; probe < 64; ++probe, slot = (slot + 1) & (LIVE - 1)) {
+        if (!blocks[slot].pointer) {
+            blocks[slot].pointer = (uintptr_t)pointer;
+            blocks[slot].size = size;
+            blocks[slot].site = index;
+            placed = 1;
+            break;
+        }
+    }
+    if (!placed) {
+        untracked++;
+        site->live -= size;
+        live_bytes -= size;
+    }
+    release();
+    busy = 0;
+}
+
+static void record_free(void *pointer) {
+    if (!enabled || !pointer)
+        return;
+    acquire();
+    uint32_t slot = hash_pointer((uintptr_t)pointer);
+    for (uint32_t probe = 0; probe < 64; ++probe, slot = (slot + 1) & (LIVE - 1)) {
+        if (!blocks[slot].pointer)
+            break;
+        if (blocks[slot].pointer != (uintptr_t)pointer)
+            continue;
+        free_count++;
+        live_bytes -= blocks[slot].size;
+        sites[blocks[slot].site].live -= blocks[slot].size;
+
+        /* Backward shift deletion keeps probe chains intact without tombstones */
+        uint32_t hole = slot;
+        for (uint32_t next = (hole + 1) & (LIVE - 1); blocks[next].pointer; next = (next + 1) & (LIVE - 1)) {
+            uint32_t home = hash_pointer(blocks[next].pointer);
+            if (((next - home) & (LIVE - 1)) >= ((next - hole) & (LIVE - 1))) {
+                blocks[hole] = blocks[next];
+                hole = next;
+            }
+        }
+        memset(&blocks[hole], 0, sizeof blocks[hole]);
+        break;
+    }
+    release();
+}
+
+void *malloc(size_t size) {
+    void *pointer = __libc_malloc(size);
+    record_alloc(pointer, size);
+    return pointer;
+}
+
+void *calloc(size_t count, size_t size) {
+    void *pointer = __libc_calloc(count, size);
+    record_alloc(pointer, count * size);
+    return pointer;
+}
+
+void *realloc(void *old, size_t size) {
+    void *pointer = __libc_realloc(old, size);
+    /* On failure the old block stays live; realloc(p, 0) frees it */
+    if (pointer || size == 0)
+        record_free(old);
+    record_alloc(pointer, size);
+    return pointer;
+}
+
+void free(void *pointer) {
+    record_free(pointer);
+    __libc_free(pointer);
+}
+
+void *memalign(size_t alignment, size_t size) {
+    void *pointer = __libc_memalign(alignment, size);
+    record_alloc(pointer, size);
+    return pointer;
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+    return memalign(alignment, size);
+}
+
+int posix_memalign(void **result, size_t alignment, size_t size) {
+    void *pointer = __libc_memalign(alignment, size);
+    if (!pointer)
+        return ENOMEM;
+    record_alloc(pointer, size);
+    *result = pointer;
+    return 0;
+}
+
+static int find_main(struct dl_phdr_info *info, size_t size, void *data) {
+    (void)size;
+    (void)data;
+    exe_bias = info->dlpi_addr;
+    for (int i = 0; i < info->dlpi_phnum && exe_segments < 16; ++i) {
+        if (info->dlpi_phdr[i].p_type != PT_LOAD)
+            continue;
+        exe_start[exe_segments] = info->dlpi_addr + info->dlpi_phdr[i].p_vaddr;
+        exe_end[exe_segments] = exe_start[exe_segments] + info->dlpi_phdr[i].p_memsz;
+        ++exe_segments;
+    }
+    return 1; /* the executable always comes first */
+}
+
+__attribute__((constructor)) static void start_profiler(void) {
+    const char *path = getenv("CODEIDE_HEAP_OUT");
+    const char *program = getenv("CODEIDE_HEAP_PROGRAM");
+    if (!path || !program || strlen(path) >= sizeof(output))
+        return;
+
+    /* The measuring wrapper sees the same environment, only the target counts */
+    char self[PATH_MAX], target[PATH_MAX];
+    ssize_t length = readlink("/proc/self/exe", self, sizeof self - 1);
+    if (length <= 0 || !realpath(program, target))
+        return;
+    self[length] = 0;
+    if (strcmp(self, target) != 0)
+        return;
+    strcpy(output, path);
+    unsetenv("CODEIDE_HEAP_OUT");
+
+    sites = mmap(NULL, sizeof(struct site) * SITES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    blocks = mmap(NULL, sizeof(struct block) * LIVE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (sites == MAP_FAILED || blocks == MAP_FAILED)
+        return;
+    dl_iterate_phdr(find_main, NULL);
+    enabled = 1;
+}
+
+__attribute__((destructor)) static void write_report(void) {
+    if (!enabled)
+        return;
+    busy = 1;
+    acquire();
+    enabled = 0;
+    release();
+
+    FILE *file = fopen(output, "w");
+    if (!file)
+        return;
+    fprintf(file, "total\t%llu\t%llu\t%llu\t%llu\t%llu\t%llu\n",
+            (unsigned long long)total_count, (unsigned long long)total_bytes,
+            (unsigned long long)free_count, (unsigned long long)peak_bytes,
+            (unsigned long long)live_bytes, (unsigned long long)untracked);
+    for (int i = 0; i < SITES; ++i) {
+        if (!sites[i].used)
+            continue;
+        fprintf(file, "%llu\t%llu\t%llu", (unsigned long long)sites[i].count,
+                (unsigned long long)sites[i].bytes, (unsigned long long)sites[i].live);
+        for (int d = 0; d < DEPTH && sites[i].frames[d]; ++d)
+            fprintf(file, "\t%lx", (unsigned long)sites[i].frames[d]);
+        fputc('\n', file);
+    }
+    fclose(file);
+}
+)HEAP";
+
+HeapPanel::HeapPanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    summaryLabel = new QLabel("Çalıştır menüsünden \"Bellek Profili Çıkar\" açıkken programı çalıştırın");
+    summaryLabel->setStyleSheet("QLabel { color: #cccccc; }");
+    summaryLabel->setWordWrap(true);
+    summaryLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+
+    table = new QTableWidget(0, 6);
+    table->setHorizontalHeaderLabels({"Satır", "Fonksiyon", "Ayıran", "Ayırma", "Bayt", "Çıkışta canlı"});
+    table->horizontalHeader()->setSectionResizeMode(1, QHeaderView::Stretch);
+    table->horizontalHeader()->setSectionResizeMode(2, QHeaderView::Stretch);
+    table->verticalHeader()->setVisible(false);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                         "gridline-color: #454545; border: none; }"
+                         "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                         "border: none; padding: 3px; }");
+    connect(table, &QTableWidget::cellClicked, this, [this](int row) {
+        int line = table->item(row, 0)->data(Qt::DisplayRole).toInt();
+        if (line > 0)
+            emit sourceLineActivated(line);
+    });
+
+    layout->addWidget(summaryLabel);
+    layout->addWidget(table);
+}
+
+void HeapPanel::prepare(BuildPipeline *pipeline, const QString &language, const RunTarget &target,
+                        ReadyCallback ready) {
+    this->pipeline = pipeline;
+    this->target = target;
+    sourceName = "main" + BuildPipeline::sourceSuffix(language);
+    int current = ++generation;
+    reportFile = QDir(pipeline->rootDir()).filePath(QString("heap-%1.txt").arg(current));
+
+    if (!BuildPipeline::isCompiled(language)) {
+        summaryLabel->setText("Bellek profili yalnızca C ve C++ için kullanılabilir");
+        ready(QProcessEnvironment());
+        return;
+    }
+#ifndef Q_OS_LINUX
+    summaryLabel->setText("Bellek profili yalnızca Linux'ta kullanılabilir");
+    ready(QProcessEnvironment());
+    return;
+#endif
+
+    summaryLabel->setText("Bellek profilleyici hazırlanıyor...");
+    pipeline->buildPreload("heap", QByteArray(interposerSource), [this, current, target, ready](const QString &library,
+                                                                                               const QString &log) {
+        if (library.isEmpty()) {
+            summaryLabel->setText("✗ Bellek profilleyici derlenemedi:\n" + log);
+            ready(QProcessEnvironment());
+            return;
+        }
+
+        // The measuring wrapper inherits the preload too, the interposer
+        // only switches itself on inside the target program
+        QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+        QString preload = environment.value("LD_PRELOAD");
+        environment.insert("LD_PRELOAD", preload.isEmpty() ? library : library + ":" + preload);
+        environment.insert("CODEIDE_HEAP_OUT", reportFile);
+        environment.insert("CODEIDE_HEAP_PROGRAM", target.program);
+        if (current == generation)
+            summaryLabel->setText("Program çalışıyor...");
+        ready(environment);
+    });
+}
+
+void HeapPanel::collect() {
+    QFile file(reportFile);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        summaryLabel->setText("Bellek profili yok, program normal şekilde sonlanmadı (çökme, _exit veya sinyal)");
+        table->setRowCount(0);
+        return;
+    }
+
+    QVector<Site> sites;
+    QSet<quint64> unique;
+    totals.clear();
+    while (!file.atEnd()) {
+        QStringList fields = QString::fromUtf8(file.readLine()).trimmed().split('\t');
+        if (fields.first() == "total" && fields.size() >= 7) {
+            auto kb = [](const QString &bytes) { return QString::number(bytes.toDouble() / 1024.0, 'f', 1); };
+            totals = QString("%1 ayırma, toplam %2 KB | %3 serbest bırakma | tepe canlı yığın %4 KB | "
+                             "çıkışta canlı %5 KB")
+                         .arg(fields[1], kb(fields[2]), fields[3], kb(fields[4]), kb(fields[5]));
+            if (fields[6] != "0")
+                totals += QString(" | %1 blok izlenemedi").arg(fields[6]);
+            continue;
+        }
+        if (fields.size() < 3)
+            continue;
+
+        Site site;
+        site.count = fields[0].toLongLong();
+        site.bytes = fields[1].toLongLong();
+        site.live = fields[2].toLongLong();
+        // Return addresses, one byte back is the call
+        for (int i = 3; i < fields.size(); ++i) {
+            quint64 address = fields[i].toULongLong(nullptr, 16) - 1;
+            site.frames << address;
+            unique.insert(address);
+        }
+        sites.append(site);
+    }
+    file.close();
+    QFile::remove(reportFile);
+
+    summaryLabel->setText(totals + " | çağrı yerleri çözülüyor...");
+    int current = generation;
+    Symbolizer::resolve(pipeline, target.program, unique.values(),
+                        [this, current, sites](const QHash<quint64, QVector<SourceLocation>> &locations) {
+        if (current == generation)
+            showReport(sites, locations);
+    });
+}
+
+void HeapPanel::showReport(const QVector<Site> &sites, const QHash<quint64, QVector<SourceLocation>> &locations) {
+    struct Row {
+        int line = 0;
+        QString function;
+        QString allocator;
+        qint64 count = 0;
+        qint64 bytes = 0;
+        qint64 live = 0;
+    };
+
+    // A call stack is charged to its innermost line in the buffer; the
+    // innermost function overall (vector growth, string copies...) is
+    // what actually asked for the memory
+    QHash<QString, Row> rows;
+    for (const Site &site : sites) {
+        Row row;
+        for (quint64 frame : site.frames) {
+            for (const SourceLocation &location : locations.value(frame)) {
+                if (row.allocator.isEmpty())
+                    row.allocator = location.function;
+                if (location.file == sourceName && location.line > 0) {
+                    row.line = location.line;
+                    row.function = location.function;
+                    break;
+                }
+            }
+            if (row.line > 0)
+                break;
+        }
+        if (row.allocator == row.function)
+            row.allocator = "malloc / new";
+
+        QString key = QString("%1\x1f%2\x1f%3").arg(row.line).arg(row.function, row.allocator);
+        Row &merged = rows[key];
+        if (merged.count == 0) {
+            merged.line = row.line;
+            merged.function = row.function.isEmpty() ? "[" + sourceName + " dışında]" : row.function;
+            merged.allocator = row.allocator;
+        }
+        merged.count += site.count;
+        merged.bytes += site.bytes;
+        merged.live += site.live;
+    }
+
+    const QList<Row> ordered = rows.values();
+    // Numbers go in as numbers so the columns sort numerically
+    table->setSortingEnabled(false);
+    table->setRowCount(ordered.size());
+    for (int i = 0; i < ordered.size(); ++i) {
+        const Row &row = ordered[i];
+        QTableWidgetItem *line = new QTableWidgetItem();
+        line->setData(Qt::DisplayRole, row.line);
+        QTableWidgetItem *count = new QTableWidgetItem();
+        count->setData(Qt::DisplayRole, row.count);
+        QTableWidgetItem *bytes = new QTableWidgetItem();
+        bytes->setData(Qt::DisplayRole, row.bytes);
+        QTableWidgetItem *live = new QTableWidgetItem();
+        live->setData(Qt::DisplayRole, row.live);
+        if (row.live > 0)
+            live->setForeground(QColor(244, 135, 113));
+
+        table->setItem(i, 0, line);
+        table->setItem(i, 1, new QTableWidgetItem(row.function));
+        table->setItem(i, 2, new QTableWidgetItem(row.allocator));
+        table->setItem(i, 3, count);
+        table->setItem(i, 4, bytes);
+        table->setItem(i, 5, live);
+    }
+    table->setSortingEnabled(true);
+    table->sortItems(3, Qt::DescendingOrder);
+
+    summaryLabel->setText(totals);
+    emit reportReady();
+}
@@ -0,0 +1,58 @@
+#ifndef HEAPPANEL_H
+#define HEAPPANEL_H
+
+#include <QWidget>
+#include <QHash>
+#include <QProcessEnvironment>
+#include <QVector>
+#include <functional>
+#include "buildpipeline.h"
+#include "symbolizer.h"
+
+class QLabel;
+class QTableWidget;
+
+// Heap profile of a normal run: a malloc/free interposer preloaded into the
+// program counts allocations per call stack, and after exit the call sites
+// are symbolized against the -g build and listed by source line.
+class HeapPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    using ReadyCallback = std::function<void(const QProcessEnvironment &environment)>;
+
+    explicit HeapPanel(QWidget *parent = nullptr);
+
+    // Builds the interposer and hands back the environment to start the
+    // program with; an empty environment means the run goes unprofiled
+    void prepare(BuildPipeline *pipeline, const QString &language, const RunTarget &target,
+                 ReadyCallback ready);
+    // Reads the report once the program has exited
+    void collect();
+
+signals:
+    void sourceLineActivated(int line);
+    void reportReady();
+
+private:
+    struct Site {
+        qint64 count = 0;
+        qint64 bytes = 0;
+        qint64 live = 0;
+        QList<quint64> frames;
+    };
+
+    void showReport(const QVector<Site> &sites, const QHash<quint64, QVector<SourceLocation>> &locations);
+
+    QLabel *summaryLabel;
+    QTableWidget *table;
+
+    BuildPipeline *pipeline = nullptr;
+    RunTarget target;
+    QString sourceName;
+    QString reportFile;
+    QString totals;
+    int generation = 0;
+};
+
+#endif // HEAPPANEL_H
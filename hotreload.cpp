@@ -0,0 +1,200 @@
+#include "hotreload.h"
+#include "buildpipeline.h"
+
+// argv[1] is the run marker, stdin carries "library\tinput\tstats" lines.
+// setup() runs in the host itself so its state outlives every step; the
+// libraries it came from stay loaded for the same reason.
+static const char hostSource[] = R"HOST(
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef void *(*SetupFunction)(void);
+typedef int (*StepFunction)(void *);
+
+static void *state;
+static int initialized;
+
+static double elapsedMs(const struct timespec *start, const struct timespec *end) {
+    return (end->tv_sec - start->tv_sec) * 1e3 + (end->tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static double timevalMs(struct timeval tv) {
+    return tv.tv_sec * 1e3 + tv.tv_usec / 1e3;
+}
+
+static void writeStats(const char *path, int status, double wallMs, const struct rusage *usage) {
+    FILE *out = fopen(path, "w");
+    if (!out)
+        return;
+    fprintf(out, "exit=%d\n", WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+    fprintf(out, "signal=%d\n", WIFSIGNALED(status) ? WTERMSIG(status) : 0);
+    fprintf(out, "wall_ms=%.3f\n", wallMs);
+    fprintf(out, "user_ms=%.3f\n", timevalMs(usage->ru_utime));
+    fprintf(out, "sys_ms=%.3f\n", timevalMs(usage->ru_stime));
+#ifdef __APPLE__
+    fprintf(out, "max_rss_kb=%ld\n", usage->ru_maxrss / 1024);
+#else
+    fprintf(out, "max_rss_kb=%ld\n", usage->ru_maxrss);
+#endif
+    fprintf(out, "minor_faults=%ld\n", usage->ru_minflt);
+    fprintf(out, "major_faults=%ld\n", usage->ru_majflt);
+    fprintf(out, "voluntary_switches=%ld\n", usage->ru_nvcsw);
+    fprintf(out, "involuntary_switches=%ld\n", usage->ru_nivcsw);
+    fclose(out);
+}
+
+static void redirectInput(const char *input) {
+    int fd = open(*input ? input : "/dev/null", O_RDONLY);
+    if (fd >= 0) {
+        dup2(fd, STDIN_FILENO);
+        close(fd);
+    }
+}
+
+static int runSetup(const char *library, const char *input) {
+    void *handle = dlopen(library, RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        fprintf(stderr, "%s\n", dlerror());
+        return 0;
+    }
+
+    SetupFunction setup = (SetupFunction)dlsym(handle, "setup");
+    if (setup) {
+        struct timespec start, end;
+        redirectInput(input);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        state = setup();
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        redirectInput("");
+        printf("[setup() %.2f ms, durum saklandı]\n", elapsedMs(&start, &end));
+    }
+    fflush(stdout);
+    fflush(stderr);
+    return 1;
+}
+
+static void runStep(const char *library, const char *input) {
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+    redirectInput(input);
+
+    void *handle = dlopen(library, RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        fprintf(stderr, "%s\n", dlerror());
+        _exit(127);
+    }
+    StepFunction step = (StepFunction)dlsym(handle, "step");
+    if (!step) {
+        fprintf(stderr, "step() bulunamadı, extern \"C\" int step(void *state) tanımlayın\n");
+        _exit(127);
+    }
+
+    int code = step(state);
+    fflush(stdout);
+    fflush(stderr);
+    _exit(code & 0xff);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2)
+        return 2;
+    const char *marker = argv[1];
+
+    // Requests keep their own descriptor, setup() and step() read the
+    // selected input on stdin
+    FILE *requests = fdopen(dup(STDIN_FILENO), "r");
+    redirectInput("");
+
+    char line[16384];
+    while (requests && fgets(line, sizeof(line), requests)) {
+        line[strcspn(line, "\n")] = '\0';
+        char *library = line;
+        char *input = strchr(library, '\t');
+        if (!input)
+            continue;
+        *input++ = '\0';
+        char *stats = strchr(input, '\t');
+        if (!stats)
+            continue;
+        *stats++ = '\0';
+
+        int status = 127 << 8;
+        struct rusage usage;
+        struct timespec start, end;
+        memset(&usage, 0, sizeof(usage));
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        if (!initialized)
+            initialized = runSetup(library, input);
+        if (initialized) {
+            fflush(stdout);
+            fflush(stderr);
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            pid_t pid = fork();
+            if (pid == 0)
+                runStep(library, input);
+            if (pid < 0)
+                perror("fork");
+            else
+                while (wait4(pid, &status, 0, &usage) < 0 && errno == EINTR) {}
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        writeStats(stats, status, elapsedMs(&start, &end), &usage);
+
+        int exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+        printf("%s%d\n", marker, exitCode);
+        fflush(stdout);
+        fprintf(stderr, "%s%d\n", marker, exitCode);
+        fflush(stderr);
+    }
+    return 0;
+}
+)HOST";
+
+HotReloadHost::HotReloadHost(QObject *parent) : ForkServer(parent) {
+}
+
+void HotReloadHost::run(BuildPipeline *buildPipeline, const QString &language, const QString &code,
+                        const QStringList &flags, const QString &inputFile, const QString &statsFile) {
+    if (isBusy())
+        return;
+
+    pipeline = buildPipeline;
+    building = true;
+    pipeline->build("C", QString::fromUtf8(hostSource), {"-O2", "-ldl"},
+                    [=](const RunTarget &host, const QString &log) {
+        if (!host.isValid()) {
+            building = false;
+            emit output(StandardError, log.toUtf8());
+            emit failed("✗ Yeniden yükleme sunucusu derlenemedi");
+            return;
+        }
+        buildLibrary(host.program, language, code, flags, inputFile, statsFile);
+    });
+}
+
+void HotReloadHost::buildLibrary(const QString &host, const QString &language, const QString &code,
+                                 const QStringList &flags, const QString &inputFile, const QString &statsFile) {
+    QStringList libraryFlags = flags;
+    libraryFlags << "-shared" << "-fPIC";
+    pipeline->build(language, code, libraryFlags, [=](const RunTarget &library, const QString &log) {
+        building = false;
+        if (!library.isValid()) {
+            emit output(StandardError, log.toUtf8());
+            emit failed("✗ Derleme hatası");
+            return;
+        }
+        launch(host, {QString::fromLatin1(marker())});
+        send(library.program, inputFile, statsFile);
+    });
+}
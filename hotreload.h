@@ -0,0 +1,35 @@
+#ifndef HOTRELOAD_H
+#define HOTRELOAD_H
+
+#include "forkserver.h"
+
+class BuildPipeline;
+
+// Hot reload for C/C++. The program is built as a shared library exporting
+//   extern "C" void *setup(void);      (optional, runs once per host)
+//   extern "C" int step(void *state);  (runs on every F5)
+// A small host process calls setup() from the first library and keeps the
+// state it returns. Each run forks a child that dlopens the freshly built
+// library and calls step(state), so a crash only takes the child down and
+// the next run starts from the same state again.
+class HotReloadHost : public ForkServer {
+    Q_OBJECT
+
+public:
+    explicit HotReloadHost(QObject *parent = nullptr);
+
+    void run(BuildPipeline *pipeline, const QString &language, const QString &code,
+             const QStringList &flags, const QString &inputFile, const QString &statsFile);
+    bool isBusy() const { return building || isRunning(); }
+    // Drops the setup() state, the next run starts a new host
+    void reset() { shutdown(); }
+
+private:
+    void buildLibrary(const QString &host, const QString &language, const QString &code,
+                      const QStringList &flags, const QString &inputFile, const QString &statsFile);
+
+    BuildPipeline *pipeline = nullptr;
+    bool building = false;
+};
+
+#endif // HOTRELOAD_H
@@ -0,0 +1,179 @@
+#include "jsrunner.h"
+#include <QJSEngine>
+#include <QJSValue>
+#include <QMutexLocker>
+#include <QRegularExpression>
+#include <QTimer>
+
+// Installs console, print, readline and readInput on the global object.
+// Values are formatted roughly the way node prints them: strings as they
+// are, errors with their stack, everything else as JSON when possible.
+static const char preludeSource[] = R"JS(
+(function (global, sink, input) {
+    var lines = input.length > 0 ? input.split("\n") : [];
+    if (lines.length > 0 && lines[lines.length - 1] === "")
+        lines.pop();
+    var next = 0;
+
+    function format(value) {
+        if (typeof value === "string")
+            return value;
+        if (value instanceof Error)
+            return value.stack ? value + "\n" + value.stack : String(value);
+        if (typeof value === "function" || value === undefined)
+            return String(value);
+        try {
+            var text = JSON.stringify(value);
+            if (text !== undefined)
+                return text;
+        } catch (e) {
+        }
+        return String(value);
+    }
+
+    function writer(stream) {
+        return function () {
+            sink.write(stream, Array.prototype.map.call(arguments, format).join(" ") + "\n");
+        };
+    }
+
+    global.console = {
+        log: writer(0), info: writer(0), debug: writer(0),
+        warn: writer(1), error: writer(1)
+    };
+    global.print = global.console.log;
+    global.readline = function () { return next < lines.length ? lines[next++] : null; };
+    global.readInput = function () { return input; };
+})
+)JS";
+
+static const int flushBytes = 16 * 1024;
+static const int flushIntervalMs = 50;
+
+void JsWorker::interrupt() {
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    QMutexLocker locker(&engineMutex);
+    if (engine)
+        engine->setInterrupted(true);
+#endif
+}
+
+void JsWorker::write(int stream, const QString &text) {
+    if (stream != bufferStream && !buffer.isEmpty())
+        flush();
+    bufferStream = stream;
+    buffer += text;
+    if (buffer.size() >= flushBytes || flushTimer.elapsed() >= flushIntervalMs)
+        flush();
+}
+
+void JsWorker::flush() {
+    if (!buffer.isEmpty())
+        emit output(bufferStream, buffer);
+    buffer.clear();
+    flushTimer.restart();
+}
+
+void JsWorker::run(const QString &code, const QString &input) {
+    QElapsedTimer timer;
+    timer.start();
+
+    // A fresh engine per run, so globals never leak between runs
+    QJSEngine scriptEngine;
+    QJSEngine::setObjectOwnership(this, QJSEngine::CppOwnership);
+    QJSValue prelude = scriptEngine.evaluate(QString::fromUtf8(preludeSource), "prelude.js");
+    prelude.call({scriptEngine.globalObject(), scriptEngine.newQObject(this), input});
+    {
+        QMutexLocker locker(&engineMutex);
+        engine = &scriptEngine;
+    }
+    double setupMs = timer.nsecsElapsed() / 1e6;
+
+    buffer.clear();
+    flushTimer.start();
+    timer.restart();
+    QJSValue result = scriptEngine.evaluate(code, "main.js");
+    double runMs = timer.nsecsElapsed() / 1e6;
+    flush();
+
+    {
+        QMutexLocker locker(&engineMutex);
+        engine = nullptr;
+    }
+
+    QString error;
+    if (result.isError()) {
+        error = result.toString();
+        int line = result.property("lineNumber").toInt();
+        if (line > 0)
+            error += QString(" (satır %1)").arg(line);
+    }
+    emit finished(error.isEmpty(), error, setupMs, runMs);
+}
+
+JsRunner::JsRunner(QObject *parent)
+    : QObject(parent), worker(new JsWorker) {
+    worker->moveToThread(&thread);
+    connect(worker, &JsWorker::output, this, &JsRunner::output);
+    connect(worker, &JsWorker::finished, this, &JsRunner::onWorkerFinished);
+    thread.setObjectName("JsRunner");
+    thread.start();
+
+    budgetTimer = new QTimer(this);
+    budgetTimer->setSingleShot(true);
+    connect(budgetTimer, &QTimer::timeout, this, [this]() {
+        timedOut = true;
+        worker->interrupt();
+    });
+}
+
+JsRunner::~JsRunner() {
+    worker->interrupt();
+    thread.quit();
+    thread.wait();
+    delete worker;
+}
+
+void JsRunner::start(const QString &code, const QString &input, int limitMs) {
+    if (running)
+        return;
+
+    running = true;
+    timedOut = false;
+    timeLimitMs = limitMs;
+    if (timeLimitMs > 0)
+        budgetTimer->start(timeLimitMs);
+
+    JsWorker *target = worker;
+    QMetaObject::invokeMethod(worker, [target, code, input]() {
+        target->run(code, input);
+    }, Qt::QueuedConnection);
+}
+
+void JsRunner::stop() {
+    if (running)
+        worker->interrupt();
+}
+
+bool JsRunner::needsNode(const QString &code) {
+    static const QRegularExpression nodeApi(
+        "\\brequire\\s*\\(|\\bprocess\\s*\\.|^\\s*import\\b|^\\s*export\\b|\\bBuffer\\b|"
+        "\\b__dirname\\b|\\b__filename\\b|\\bset(Timeout|Interval|Immediate)\\s*\\(|"
+        "\\bqueueMicrotask\\s*\\(|\\bawait\\b",
+        QRegularExpression::MultilineOption);
+    return nodeApi.match(code).hasMatch();
+}
+
+void JsRunner::onWorkerFinished(bool ok, const QString &error, double setupMs, double runMs) {
+    budgetTimer->stop();
+    running = false;
+
+    QString summary = QString("Motor: %1 ms | Betik: %2 ms (QJSEngine, süreç içi)")
+                          .arg(setupMs, 0, 'f', 2)
+                          .arg(runMs, 0, 'f', 2);
+    if (timedOut)
+        summary = QString("Zaman sınırı aşıldı (%1 ms), betik durduruldu | ").arg(timeLimitMs) + summary;
+    else if (!ok)
+        summary = "Hata: " + error + " | " + summary;
+    emit finished(ok && !timedOut, summary);
+}
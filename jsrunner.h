@@ -0,0 +1,79 @@
+#ifndef JSRUNNER_H
+#define JSRUNNER_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QThread>
+
+class QJSEngine;
+class QTimer;
+
+// Lives on the worker thread and owns the QJSEngine for one run at a time.
+// Scripts write through the console object installed by run(); output is
+// buffered here and handed to the GUI thread in chunks, so a loop printing
+// a line per iteration does not queue one signal per line.
+class JsWorker : public QObject {
+    Q_OBJECT
+
+public:
+    // Called from the GUI thread; the engine aborts the script at the next
+    // interruption check
+    void interrupt();
+
+    Q_INVOKABLE void write(int stream, const QString &text);
+
+public slots:
+    void run(const QString &code, const QString &input);
+
+signals:
+    void output(int stream, const QString &text);
+    void finished(bool ok, const QString &error, double setupMs, double runMs);
+
+private:
+    void flush();
+
+    QMutex engineMutex;
+    QJSEngine *engine = nullptr;
+    QString buffer;
+    int bufferStream = 0;
+    QElapsedTimer flushTimer;
+};
+
+// Runs JavaScript inside the IDE process with QJSEngine on a worker thread.
+// There is no process to spawn, so small scripts start in well under a
+// millisecond; scripts that need Node APIs still go through node.
+class JsRunner : public QObject {
+    Q_OBJECT
+
+public:
+    enum Stream { StandardOutput, StandardError };
+
+    explicit JsRunner(QObject *parent = nullptr);
+    ~JsRunner() override;
+
+    void start(const QString &code, const QString &input, int timeLimitMs = 10000);
+    void stop();
+    bool isRunning() const { return running; }
+
+    // True when the script uses require, process, timers or other Node APIs
+    // that a bare QJSEngine does not provide
+    static bool needsNode(const QString &code);
+
+signals:
+    void output(int stream, const QString &text);
+    void finished(bool ok, const QString &summary);
+
+private slots:
+    void onWorkerFinished(bool ok, const QString &error, double setupMs, double runMs);
+
+private:
+    QThread thread;
+    JsWorker *worker;
+    QTimer *budgetTimer;
+    bool running = false;
+    bool timedOut = false;
+    int timeLimitMs = 0;
+};
+
+#endif // JSRUNNER_H
@@ -0,0 +1,281 @@
+#include "languagebackend.h"
+#include <QDir>
+#include <QFileInfo>
+#include <QRegularExpression>
+#include <algorithm>
+
+QString LanguageBackend::fileFilter() const {
+    QStringList patterns;
+    for (const QString &suffix : fileSuffixes())
+        patterns << "*" + suffix;
+    return QString("%1 Files (%2)").arg(name(), patterns.join(' '));
+}
+
+QByteArray LanguageBackend::cacheKey(const BuildRequest &request) const {
+    Q_UNUSED(request);
+    return QByteArray();
+}
+
+void LanguageBackend::build(BuildPipeline *pipeline, const BuildRequest &request,
+                            BuildPipeline::StepCallback done) const {
+    Q_UNUSED(pipeline);
+    Q_UNUSED(request);
+    done(false, "Hata: " + name() + " derlenmiyor!");
+}
+
+RunTarget LanguageBackend::runTarget(const QString &tool, const QString &source, const QString &program) const {
+    RunTarget target;
+    if (isCompiled()) {
+        target.program = program;
+        target.buildDir = QFileInfo(program).path();
+    } else {
+        target.program = tool;
+        target.arguments << source;
+        target.buildDir = QFileInfo(source).path();
+    }
+    return target;
+}
+
+QVector<Diagnostic> LanguageBackend::parseDiagnostics(const QString &log) const {
+    Q_UNUSED(log);
+    return QVector<Diagnostic>();
+}
+
+// GCC and GCC-compatible compilers. The source is compiled to an object
+// file and linked in a second step, each cached on its own: the object only
+// depends on the flags the compiler uses, so builds that differ in linker
+// flags alone (-static, -s, -l...) compile once and only link again.
+class GccBackend : public LanguageBackend {
+public:
+    GccBackend(const QString &language, const QString &compiler, const QStringList &suffixes,
+               const char *templateSource)
+        : language(language), compiler(compiler), suffixes(suffixes), templateSource(templateSource) {}
+
+    QString name() const override { return language; }
+    QString sourceSuffix() const override { return suffixes.first(); }
+    QStringList fileSuffixes() const override { return suffixes; }
+    QString templateCode() const override { return QString::fromUtf8(templateSource); }
+    QString defaultTool() const override { return compiler; }
+    bool isCompiled() const override { return true; }
+
+    QByteArray cacheKey(const BuildRequest &request) const override {
+        return request.linker.toUtf8() + (request.splitDwarf ? "\nsplit-dwarf" : "");
+    }
+
+    void build(BuildPipeline *pipeline, const BuildRequest &request,
+               BuildPipeline::StepCallback done) const override;
+    QVector<Diagnostic> parseDiagnostics(const QString &log) const override;
+
+private:
+    void link(BuildPipeline *pipeline, const BuildRequest &request, const QString &object,
+              const QString &compileLog, BuildPipeline::StepCallback done) const;
+
+    QString language;
+    QString compiler;
+    QStringList suffixes;
+    const char *templateSource;
+};
+
+// Flags that only mean something to the linker, the object file is the
+// same with or without them
+static bool isLinkerFlag(const QString &flag) {
+    static const QStringList linkerOnly = {"-static", "-s", "-shared", "-rdynamic", "-pie", "-no-pie",
+                                           "-static-libgcc", "-static-libstdc++"};
+    return linkerOnly.contains(flag) || flag.startsWith("-l") || flag.startsWith("-L") ||
+           flag.startsWith("-Wl,") || flag.startsWith("-fuse-ld=");
+}
+
+static bool isDebugFlag(const QString &flag) {
+    static const QRegularExpression debugRe("^-g(gdb)?[1-3]?$");
+    return debugRe.match(flag).hasMatch();
+}
+
+void GccBackend::build(BuildPipeline *pipeline, const BuildRequest &request,
+                       BuildPipeline::StepCallback done) const {
+    QStringList compileFlags;
+    bool debug = false;
+    bool dwarfVersion = false;
+    for (const QString &flag : request.flags) {
+        if (isLinkerFlag(flag))
+            continue;
+        compileFlags << flag;
+        debug = debug || isDebugFlag(flag);
+        dwarfVersion = dwarfVersion || flag.startsWith("-gdwarf");
+    }
+    // addr2line cannot follow DWARF 5 skeleton units to their .dwo yet,
+    // DWARF 4 split units it can
+    if (request.splitDwarf && debug && !compileFlags.contains("-gsplit-dwarf")) {
+        compileFlags << "-gsplit-dwarf";
+        if (!dwarfVersion)
+            compileFlags << "-gdwarf-4";
+    }
+
+    QString key = BuildPipeline::sourceKey(language, compileFlags.join('\n') + '\n' + request.code);
+    QString object = QDir(pipeline->rootDir()).filePath("object-" + key) + "/main.o";
+    QStringList arguments;
+    arguments << "-c" << request.source << compileFlags << "-o" << object;
+    pipeline->cachedStep(object, compiler, arguments, [=](bool ok, const QString &log) {
+        if (!ok)
+            done(false, log);
+        else
+            link(pipeline, request, object, log, done);
+    });
+}
+
+void GccBackend::link(BuildPipeline *pipeline, const BuildRequest &request, const QString &object,
+                      const QString &compileLog, BuildPipeline::StepCallback done) const {
+    bool chosenByUser = std::any_of(request.flags.begin(), request.flags.end(), [](const QString &flag) {
+        return flag.startsWith("-fuse-ld=");
+    });
+    QStringList arguments;
+    arguments << object << request.flags;
+    if (!request.linker.isEmpty() && !chosenByUser)
+        arguments << "-fuse-ld=" + request.linker;
+    arguments << "-o" << request.program;
+
+    QString tool = compiler;
+    pipeline->runStep(tool, arguments, [=](bool ok, const QString &log) {
+        if (ok || request.linker.isEmpty() || chosenByUser || !request.automaticLinker) {
+            done(ok, compileLog + log);
+            return;
+        }
+        // An automatically picked linker failed. If the default one links
+        // the same object, the compiler cannot drive that linker (mold needs
+        // GCC 12.1) and it is skipped for the rest of the session.
+        QStringList fallback = arguments;
+        fallback.removeAll("-fuse-ld=" + request.linker);
+        pipeline->runStep(tool, fallback, [=](bool fallbackOk, const QString &fallbackLog) {
+            if (fallbackOk)
+                pipeline->dropLinker(request.linker);
+            done(fallbackOk, compileLog + fallbackLog);
+        });
+    });
+}
+
+QVector<Diagnostic> GccBackend::parseDiagnostics(const QString &log) const {
+    // /tmp/.../main.cpp:12:5: error: 'x' was not declared in this scope
+    static const QRegularExpression diagnosticRe(R"(^(.*?):(\d+):(\d+): (fatal error|error|warning): (.*)$)",
+                                                 QRegularExpression::MultilineOption);
+    QVector<Diagnostic> diagnostics;
+    QRegularExpressionMatchIterator it = diagnosticRe.globalMatch(log);
+    while (it.hasNext()) {
+        QRegularExpressionMatch match = it.next();
+        // Errors inside system headers are reported again at the include
+        if (!match.captured(1).endsWith("/main" + sourceSuffix()))
+            continue;
+        Diagnostic diagnostic;
+        diagnostic.line = match.captured(2).toInt();
+        diagnostic.column = match.captured(3).toInt();
+        diagnostic.error = match.captured(4) != "warning";
+        diagnostic.message = match.captured(5);
+        diagnostics.append(diagnostic);
+    }
+    return diagnostics;
+}
+
+class PythonBackend : public LanguageBackend {
+public:
+    QString name() const override { return "Python"; }
+    QString sourceSuffix() const override { return ".py"; }
+    QString defaultTool() const override { return "python"; }
+
+    QStringList toolCandidates() const override {
+        QStringList candidates;
+        candidates << "python3" << "python";
+        for (int minor = 14; minor >= 6; --minor)
+            candidates << QString("python3.%1").arg(minor);
+        candidates << "pypy3" << "pypy";
+        return candidates;
+    }
+
+    QString templateCode() const override {
+        return "#!/usr/bin/env python3\n"
+               "# -*- coding: utf-8 -*-\n\n"
+               "def main():\n"
+               "    print(\"Merhaba Python!\")\n"
+               "    \n"
+               "    # Kodunuzu buraya yazın\n"
+               "    \n\n"
+               "if __name__ == \"__main__\":\n"
+               "    main()\n";
+    }
+};
+
+class JavaScriptBackend : public LanguageBackend {
+public:
+    QString name() const override { return "JavaScript"; }
+    QString sourceSuffix() const override { return ".js"; }
+    QStringList fileSuffixes() const override { return {".js", ".mjs", ".cjs"}; }
+    QString defaultTool() const override { return "node"; }
+
+    QString templateCode() const override {
+        return "// JavaScript Code\n\n"
+               "function main() {\n"
+               "    console.log(\"Merhaba JavaScript!\");\n"
+               "    \n"
+               "    // Kodunuzu buraya yazın\n"
+               "    \n"
+               "}\n\n"
+               "main();\n";
+    }
+};
+
+static const char cppTemplate[] =
+    "#include <iostream>\n"
+    "#include <vector>\n"
+    "#include <string>\n\n"
+    "using namespace std;\n\n"
+    "int main() {\n"
+    "    cout << \"Merhaba C++!\" << endl;\n"
+    "    \n"
+    "    // Kodunuzu buraya yazın\n"
+    "    \n"
+    "    return 0;\n"
+    "}\n";
+
+static const char cTemplate[] =
+    "#include <stdio.h>\n"
+    "#include <stdlib.h>\n"
+    "#include <string.h>\n\n"
+    "int main() {\n"
+    "    printf(\"Merhaba C!\\n\");\n"
+    "    \n"
+    "    // Kodunuzu buraya yazın\n"
+    "    \n"
+    "    return 0;\n"
+    "}\n";
+
+// In the order of the language selector; .h opens as C++
+static const QVector<const LanguageBackend *> &backends() {
+    static const GccBackend cpp("C++", "g++", {".cpp", ".cc", ".cxx", ".h", ".hpp"}, cppTemplate);
+    static const GccBackend c("C", "gcc", {".c"}, cTemplate);
+    static const PythonBackend python;
+    static const JavaScriptBackend javaScript;
+    static const QVector<const LanguageBackend *> all = {&cpp, &c, &python, &javaScript};
+    return all;
+}
+
+const LanguageBackend *LanguageBackend::find(const QString &language) {
+    for (const LanguageBackend *backend : backends()) {
+        if (backend->name() == language)
+            return backend;
+    }
+    return nullptr;
+}
+
+const LanguageBackend *LanguageBackend::forFile(const QString &fileName) {
+    for (const LanguageBackend *backend : backends()) {
+        for (const QString &suffix : backend->fileSuffixes()) {
+            if (fileName.endsWith(suffix))
+                return backend;
+        }
+    }
+    return nullptr;
+}
+
+QStringList LanguageBackend::languages() {
+    QStringList names;
+    for (const LanguageBackend *backend : backends())
+        names << backend->name();
+    return names;
+}
@@ -0,0 +1,64 @@
+#ifndef LANGUAGEBACKEND_H
+#define LANGUAGEBACKEND_H
+
+#include <QByteArray>
+#include <QStringList>
+#include <QVector>
+#include "buildpipeline.h"
+
+struct Diagnostic {
+    int line = 0;
+    int column = 0;
+    bool error = true;
+    QString message;
+};
+
+// One build of one source revision. The code is already written to source;
+// a compiled language has to leave its binary at program.
+struct BuildRequest {
+    QString code;
+    QStringList flags;
+    QString source;
+    QString program;
+    QString linker;          // empty for the toolchain default
+    bool automaticLinker = false;
+    bool splitDwarf = false;
+};
+
+// Everything language specific that the pipeline and the IDE need: the
+// toolchain, how to build, how to run the result and how to read the
+// compiler's errors. BuildPipeline keeps the caching, deduplication and the
+// one-process-per-core limit, so every backend gets those for free, and a
+// new language is one more subclass in languagebackend.cpp.
+class LanguageBackend {
+public:
+    virtual ~LanguageBackend() = default;
+
+    virtual QString name() const = 0;
+    virtual QString sourceSuffix() const = 0;
+    // Suffixes recognised when opening a file, sourceSuffix() first
+    virtual QStringList fileSuffixes() const { return {sourceSuffix()}; }
+    virtual QString templateCode() const = 0;
+    QString fileFilter() const;
+
+    // Compiler or interpreter used when the user has not picked one
+    virtual QString defaultTool() const = 0;
+    // Tool names worth looking for, best first
+    virtual QStringList toolCandidates() const { return {defaultTool()}; }
+    virtual bool isCompiled() const { return false; }
+
+    // Inputs beyond language, flags and code that change the binary
+    virtual QByteArray cacheKey(const BuildRequest &request) const;
+    // Turns request.source into request.program; only called for compiled
+    // languages when no cached program exists
+    virtual void build(BuildPipeline *pipeline, const BuildRequest &request,
+                       BuildPipeline::StepCallback done) const;
+    virtual RunTarget runTarget(const QString &tool, const QString &source, const QString &program) const;
+    virtual QVector<Diagnostic> parseDiagnostics(const QString &log) const;
+
+    static const LanguageBackend *find(const QString &language);
+    static const LanguageBackend *forFile(const QString &fileName);
+    static QStringList languages();
+};
+
+#endif // LANGUAGEBACKEND_H
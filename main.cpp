@@ -1,7 +1,16 @@
 #include "compileride.h"
+#include "runstats.h"
+#include "pythonhost.h"
 #include <QApplication>
 
 int main(int argc, char *argv[]) {
+    // Measuring wrapper for user programs, see MeasuredRun
+    if (MeasuredRun::isWrapperInvocation(argc, argv))
+        return MeasuredRun::exec(argc, argv);
+    // Warm embedded Python helper, see PythonHost
+    if (PythonHost::isHostInvocation(argc, argv))
+        return PythonHost::exec(argc, argv);
+
     QApplication app(argc, argv);
 
     app.setApplicationName("CodeIDE");
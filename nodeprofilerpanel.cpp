@@ -0,0 +1,392 @@
+#include "nodeprofilerpanel.h"
+#include "buildpipeline.h"
+#include "flamegraph.h"
+#include <QCheckBox>
+#include <QFile>
+#include <QFileInfo>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QLabel>
+#include <QMap>
+#include <QProcess>
+#include <QPushButton>
+#include <QRegularExpression>
+#include <QScrollArea>
+#include <QSpinBox>
+#include <QSplitter>
+#include <QTableWidget>
+#include <QUrl>
+#include <QVBoxLayout>
+#include <algorithm>
+
+NodeProfilerPanel::NodeProfilerPanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+
+    heapSpin = new QSpinBox();
+    heapSpin->setRange(0, 65536);
+    heapSpin->setSingleStep(256);
+    heapSpin->setSuffix(" MB");
+    heapSpin->setSpecialValueText("Varsayılan yığın");
+    heapSpin->setToolTip("--max-old-space-size; 0 ise Node'un varsayılanı kullanılır");
+
+    gcCheck = new QCheckBox("GC izi");
+    gcCheck->setStyleSheet("QCheckBox { color: #cccccc; }");
+    gcCheck->setToolTip("--trace-gc ile çöp toplama duraklamalarını özetle");
+    gcCheck->setChecked(true);
+
+    startButton = new QPushButton("▶ Profil ile Çalıştır");
+    connect(startButton, &QPushButton::clicked, this, [this]() {
+        if (!running)
+            emit runRequested();
+    });
+    stopButton = new QPushButton("■ Durdur");
+    stopButton->setEnabled(false);
+    connect(stopButton, &QPushButton::clicked, this, &NodeProfilerPanel::stop);
+
+    bar->addWidget(heapSpin);
+    bar->addWidget(gcCheck);
+    bar->addWidget(startButton);
+    bar->addWidget(stopButton);
+    bar->addStretch();
+
+    statusLabel = new QLabel("Hazır");
+    statusLabel->setStyleSheet("QLabel { color: #cccccc; }");
+    statusLabel->setWordWrap(true);
+    statusLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+
+    gcLabel = new QLabel();
+    gcLabel->setStyleSheet("QLabel { color: #9cdcfe; }");
+    gcLabel->setWordWrap(true);
+
+    flameGraph = new FlameGraph();
+    connect(flameGraph, &FlameGraph::lineActivated, this, &NodeProfilerPanel::sourceLineActivated);
+
+    QScrollArea *scroll = new QScrollArea();
+    scroll->setWidget(flameGraph);
+    scroll->setWidgetResizable(true);
+    scroll->setStyleSheet("QScrollArea { border: none; background-color: #1e1e1e; }");
+
+    table = new QTableWidget(0, 5);
+    table->setHorizontalHeaderLabels({"Fonksiyon", "Öz (ms)", "Öz %", "Toplam %", "Satır"});
+    table->horizontalHeader()->setSectionResizeMode(0, QHeaderView::Stretch);
+    table->verticalHeader()->setVisible(false);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                         "gridline-color: #454545; border: none; }"
+                         "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                         "border: none; padding: 3px; }");
+    connect(table, &QTableWidget::cellClicked, this, [this](int row) {
+        int line = table->item(row, 4)->data(Qt::DisplayRole).toInt();
+        if (line > 0)
+            emit sourceLineActivated(line);
+    });
+
+    QSplitter *splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(scroll);
+    splitter->addWidget(table);
+    splitter->setSizes({700, 400});
+
+    layout->addLayout(bar);
+    layout->addWidget(statusLabel);
+    layout->addWidget(gcLabel);
+    layout->addWidget(splitter);
+}
+
+void NodeProfilerPanel::showError(const QString &message) {
+    statusLabel->setText(message);
+}
+
+void NodeProfilerPanel::fail(const QString &message) {
+    running = false;
+    startButton->setEnabled(true);
+    stopButton->setEnabled(false);
+    statusLabel->setText(message);
+}
+
+void NodeProfilerPanel::stop() {
+    if (!running)
+        return;
+    ++generation;
+    if (process)
+        process->kill();
+    fail("Durduruldu");
+}
+
+void NodeProfilerPanel::start(BuildPipeline *pipeline, const QString &code, const QString &inputFile,
+                              const QString &runDir) {
+    if (running)
+        return;
+
+    QString script = runDir + "/main.js";
+    QFile file(script);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        showError("Hata: Dosya oluşturulamadı!");
+        return;
+    }
+    file.write(code.toUtf8());
+    file.close();
+
+    sourceKey = BuildPipeline::sourceKey("JavaScript", code);
+    running = true;
+    startButton->setEnabled(false);
+    stopButton->setEnabled(true);
+    flameGraph->clear();
+    table->setRowCount(0);
+    gcLabel->clear();
+    statusLabel->setText("node --cpu-prof ile çalıştırılıyor...");
+
+    QString profileFile = runDir + "/profile.cpuprofile";
+    QString outputFile = runDir + "/program.out";
+    bool traceGc = gcCheck->isChecked();
+
+    QStringList arguments;
+    arguments << "--cpu-prof" << "--cpu-prof-dir=" + runDir << "--cpu-prof-name=profile.cpuprofile";
+    if (heapSpin->value() > 0)
+        arguments << QString("--max-old-space-size=%1").arg(heapSpin->value());
+    if (traceGc)
+        arguments << "--trace-gc";
+    arguments << script;
+
+    QProcess *program = new QProcess(this);
+    program->setStandardInputFile(inputFile.isEmpty() ? QProcess::nullDevice() : inputFile);
+    program->setStandardOutputFile(outputFile);
+    program->setStandardErrorFile(runDir + "/program.err");
+    program->setWorkingDirectory(runDir);
+    process = program;
+
+    QString node = pipeline->interpreter("JavaScript");
+    int current = ++generation;
+    connect(program, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            [this, program, current, profileFile, outputFile, script, traceGc, runDir]() {
+        program->deleteLater();
+        if (current != generation)
+            return;
+
+        // Written at process exit; process.exit() is fine, a crash is not
+        QFile file(profileFile);
+        if (!file.open(QIODevice::ReadOnly)) {
+            fail("Hata: CPU profili yazılmadı, ayrıntılar: " + runDir + "/program.err");
+            return;
+        }
+        if (traceGc)
+            showGcSummary(outputFile);
+        showProfile(QJsonDocument::fromJson(file.readAll()).object(), script);
+    });
+    connect(program, &QProcess::errorOccurred, [this, program, current, node](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart)
+            return;
+        program->deleteLater();
+        if (current == generation)
+            fail("Hata: " + node + " başlatılamadı!");
+    });
+
+    program->start(node, arguments);
+}
+
+void NodeProfilerPanel::showProfile(const QJsonObject &profile, const QString &script) {
+    // {"nodes": [{"id", "callFrame": {"functionName", "url", "lineNumber"}, "hitCount",
+    //             "children": [ids], "positionTicks": [{"line", "ticks"}]}],
+    //  "startTime", "endTime", "samples": [ids], "timeDeltas": [...]}
+    const QJsonArray profileNodes = profile.value("nodes").toArray();
+    if (profileNodes.isEmpty()) {
+        fail("Hata: CPU profili okunamadı");
+        return;
+    }
+
+    // Node reports the resolved path, the run directory may sit behind a symlink
+    QString scriptPath = QFileInfo(script).canonicalFilePath();
+    QHash<QString, bool> localUrls;
+    QHash<int, int> indexOf;
+    for (int i = 0; i < profileNodes.size(); ++i)
+        indexOf.insert(profileNodes[i].toObject().value("id").toInt(), i);
+
+    struct FunctionStats {
+        qint64 self = 0;
+        qint64 total = 0;
+        int line = 0;
+    };
+
+    QVector<FlameNode> nodes(profileNodes.size());
+    QVector<bool> inScript(profileNodes.size(), false);
+    QHash<QString, FunctionStats> functions;
+    LineHeat heat;
+    heat.unit = "örnek";
+
+    for (int i = 0; i < profileNodes.size(); ++i) {
+        QJsonObject node = profileNodes[i].toObject();
+        QJsonObject frame = node.value("callFrame").toObject();
+        QString url = frame.value("url").toString();
+        QString name = frame.value("functionName").toString();
+        if (!localUrls.contains(url))
+            localUrls.insert(url, !url.isEmpty() && QFileInfo(QUrl(url).toLocalFile()).canonicalFilePath() == scriptPath);
+        bool local = localUrls.value(url);
+        int line = frame.value("lineNumber").toInt() + 1;
+        if (name.isEmpty())
+            name = "(anonim)";
+        if (!local && !url.isEmpty())
+            name += "  " + QFileInfo(QUrl(url).path()).fileName();
+
+        inScript[i] = local;
+        nodes[i].name = name;
+        nodes[i].line = local ? line : 0;
+        nodes[i].self = node.value("hitCount").toInt();
+        for (const QJsonValue &child : node.value("children").toArray()) {
+            int index = indexOf.value(child.toInt(), -1);
+            if (index >= 0) {
+                nodes[i].children.append(index);
+                nodes[index].parent = i;
+            }
+        }
+
+        // Self samples per source line, exact where V8 recorded positions
+        if (local) {
+            for (const QJsonValue &tick : node.value("positionTicks").toArray()) {
+                QJsonObject position = tick.toObject();
+                heat.counts[position.value("line").toInt()] += position.value("ticks").toInt();
+            }
+        }
+    }
+
+    // The root is the parentless node; it must sit at index 0 for FlameGraph
+    int root = 0;
+    while (root < nodes.size() && nodes[root].parent >= 0)
+        ++root;
+    if (root >= nodes.size()) {
+        fail("Hata: CPU profili okunamadı");
+        return;
+    }
+    if (root != 0) {
+        std::swap(nodes[0], nodes[root]);
+        std::swap(inScript[0], inScript[root]);
+        for (FlameNode &node : nodes) {
+            if (node.parent == 0)
+                node.parent = root;
+            else if (node.parent == root)
+                node.parent = 0;
+            for (int &child : node.children)
+                child = child == 0 ? root : child == root ? 0 : child;
+        }
+    }
+
+    // Totals bottom-up; parents always come before children in a walk from the root
+    QVector<int> order;
+    order.append(0);
+    for (int i = 0; i < order.size(); ++i)
+        order += nodes[order[i]].children;
+    for (int i = order.size() - 1; i >= 0; --i) {
+        FlameNode &node = nodes[order[i]];
+        node.total += node.self;
+        if (node.parent >= 0)
+            nodes[node.parent].total += node.total;
+    }
+
+    for (int i = order.size() - 1; i >= 1; --i) {
+        const FlameNode &node = nodes[order[i]];
+        FunctionStats &stats = functions[node.name];
+        stats.self += node.self;
+        stats.line = node.line;
+        // Recursion would count the same samples again further up
+        bool recursive = false;
+        for (int parent = node.parent; parent > 0 && !recursive; parent = nodes[parent].parent)
+            recursive = nodes[parent].name == node.name;
+        if (!recursive)
+            stats.total += node.total;
+    }
+
+    for (FlameNode &node : nodes) {
+        std::sort(node.children.begin(), node.children.end(), [&nodes](int a, int b) {
+            return nodes[a].name < nodes[b].name;
+        });
+    }
+    nodes[0].name = "tümü";
+    flameGraph->setNodes(nodes);
+
+    // Sampling interval from the profile itself, microseconds
+    qint64 samples = qMax<qint64>(1, nodes[0].total);
+    double interval = (profile.value("endTime").toDouble() - profile.value("startTime").toDouble()) / samples;
+
+    QStringList names = functions.keys();
+    std::sort(names.begin(), names.end(), [&functions](const QString &a, const QString &b) {
+        return functions[a].self > functions[b].self;
+    });
+
+    table->setSortingEnabled(false);
+    int rows = qMin(names.size(), 200);
+    table->setRowCount(rows);
+    for (int row = 0; row < rows; ++row) {
+        const FunctionStats &stats = functions[names[row]];
+        QTableWidgetItem *selfMs = new QTableWidgetItem();
+        selfMs->setData(Qt::DisplayRole, qRound64(stats.self * interval / 10.0) / 100.0);
+        QTableWidgetItem *selfPercent = new QTableWidgetItem();
+        selfPercent->setData(Qt::DisplayRole, qRound64(1000.0 * stats.self / samples) / 10.0);
+        QTableWidgetItem *totalPercent = new QTableWidgetItem();
+        totalPercent->setData(Qt::DisplayRole, qRound64(1000.0 * stats.total / samples) / 10.0);
+        QTableWidgetItem *line = new QTableWidgetItem();
+        line->setData(Qt::DisplayRole, stats.line);
+
+        table->setItem(row, 0, new QTableWidgetItem(names[row]));
+        table->setItem(row, 1, selfMs);
+        table->setItem(row, 2, selfPercent);
+        table->setItem(row, 3, totalPercent);
+        table->setItem(row, 4, line);
+    }
+    table->setSortingEnabled(true);
+    table->sortItems(1, Qt::DescendingOrder);
+
+    running = false;
+    startButton->setEnabled(true);
+    stopButton->setEnabled(false);
+    statusLabel->setText(QString("%1 örnek, aralık %2 µs, süre %3 ms")
+                             .arg(nodes[0].total).arg(interval, 0, 'f', 0)
+                             .arg((profile.value("endTime").toDouble() - profile.value("startTime").toDouble()) / 1000.0,
+                                  0, 'f', 1));
+    emit lineHeatReady(sourceKey, heat);
+}
+
+void NodeProfilerPanel::showGcSummary(const QString &outputFile) {
+    // [7388:0x213f2330]  24 ms: Scavenge 4.1 (4.2) -> 3.9 (5.2) MB, 2.63 / 0.00 ms  (average mu = ...
+    static const QRegularExpression gcRe(R"(^\[\d+:0x[0-9a-f]+\]\s+\d+ ms: ([^\d]+?) [\d.]+ \([\d.]+\) -> )"
+                                         R"(([\d.]+) \([\d.]+\) MB, ([\d.]+) / [\d.]+ ms)");
+
+    QFile file(outputFile);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return;
+
+    struct Pauses {
+        int count = 0;
+        double total = 0;
+        double longest = 0;
+    };
+    QMap<QString, Pauses> byKind;
+    double peakHeap = 0;
+    while (!file.atEnd()) {
+        QRegularExpressionMatch match = gcRe.match(QString::fromUtf8(file.readLine()));
+        if (!match.hasMatch())
+            continue;
+        Pauses &pauses = byKind[match.captured(1).trimmed()];
+        double pause = match.captured(3).toDouble();
+        ++pauses.count;
+        pauses.total += pause;
+        pauses.longest = qMax(pauses.longest, pause);
+        peakHeap = qMax(peakHeap, match.captured(2).toDouble());
+    }
+
+    if (byKind.isEmpty()) {
+        gcLabel->setText("GC: çöp toplama olmadı");
+        return;
+    }
+    QStringList parts;
+    for (auto it = byKind.cbegin(); it != byKind.cend(); ++it) {
+        parts << QString("%1 ×%2, toplam %3 ms, en uzun %4 ms")
+                     .arg(it.key()).arg(it.value().count)
+                     .arg(it.value().total, 0, 'f', 1).arg(it.value().longest, 0, 'f', 1);
+    }
+    gcLabel->setText(QString("GC: %1 | GC sonrası en büyük yığın %2 MB (izler program çıktısında)")
+                         .arg(parts.join(" | ")).arg(peakHeap, 0, 'f', 1));
+}
@@ -0,0 +1,59 @@
+#ifndef NODEPROFILERPANEL_H
+#define NODEPROFILERPANEL_H
+
+#include <QWidget>
+#include <QJsonObject>
+#include <QPointer>
+#include "codeeditor.h"
+
+class BuildPipeline;
+class FlameGraph;
+class QCheckBox;
+class QLabel;
+class QProcess;
+class QPushButton;
+class QSpinBox;
+class QTableWidget;
+
+// Profiled JavaScript runs: node --cpu-prof writes a .cpuprofile into the
+// run directory, which is turned into a flame graph, a self/total table
+// and per-line samples; --trace-gc output is summarized next to it.
+class NodeProfilerPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit NodeProfilerPanel(QWidget *parent = nullptr);
+
+    void start(BuildPipeline *pipeline, const QString &code, const QString &inputFile, const QString &runDir);
+    void showError(const QString &message);
+    bool isRunning() const { return running; }
+
+signals:
+    void runRequested();
+    void sourceLineActivated(int line);
+    void lineHeatReady(const QString &sourceKey, const LineHeat &heat);
+
+private slots:
+    void stop();
+
+private:
+    void showProfile(const QJsonObject &profile, const QString &script);
+    void showGcSummary(const QString &outputFile);
+    void fail(const QString &message);
+
+    QSpinBox *heapSpin;
+    QCheckBox *gcCheck;
+    QPushButton *startButton;
+    QPushButton *stopButton;
+    QLabel *statusLabel;
+    QLabel *gcLabel;
+    FlameGraph *flameGraph;
+    QTableWidget *table;
+
+    QPointer<QProcess> process;
+    bool running = false;
+    int generation = 0;
+    QString sourceKey;
+};
+
+#endif // NODEPROFILERPANEL_H
@@ -0,0 +1,149 @@
+#include "optimizerremarks.h"
+#include "buildpipeline.h"
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QProcess>
+#include <QRegularExpression>
+#include <QSet>
+
+OptimizerRemarks::OptimizerRemarks(QObject *parent) : QObject(parent) {
+}
+
+QStringList OptimizerRemarks::remarkFlags() {
+    return {"-fopt-info-vec-all", "-fopt-info-inline-optimized-missed"};
+}
+
+void OptimizerRemarks::collect(BuildPipeline *pipeline, const QString &language, const QString &code,
+                               const QStringList &flags) {
+    if (!BuildPipeline::isCompiled(language))
+        return;
+
+    // With LTO the optimizers only run at link time
+    QStringList compileFlags;
+    bool optimized = false;
+    for (const QString &flag : flags) {
+        if (!flag.startsWith("-flto"))
+            compileFlags << flag;
+        optimized = optimized || flag.startsWith("-O");
+    }
+    // At the default -O0 nothing is inlined or vectorized, so there would
+    // be no remarks at all; show what -O2 does instead
+    if (!optimized)
+        compileFlags << "-O2";
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(compileFlags.join('\n').toUtf8());
+    QString dir = QDir(pipeline->rootDir()).filePath("remarks-" + BuildPipeline::sourceKey(language, code) +
+                                                     QString::fromLatin1(hash.result().toHex().left(8)));
+    QString sourceName = "main" + BuildPipeline::sourceSuffix(language);
+    QString logFile = dir + "/remarks.log";
+    int current = ++generation;
+
+    QFile cached(logFile);
+    if (cached.open(QIODevice::ReadOnly)) {
+        publish(QString::fromUtf8(cached.readAll()), sourceName);
+        return;
+    }
+
+    QDir().mkpath(dir);
+    QFile file(dir + "/" + sourceName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+        return;
+    file.write(code.toUtf8());
+    file.close();
+
+    QString compiler = BuildPipeline::compiler(language);
+    QStringList arguments;
+    arguments << "-S" << file.fileName() << compileFlags << remarkFlags()
+              << "-o" << QProcess::nullDevice();
+    pipeline->runStep(compiler, arguments, [this, current, logFile, sourceName](bool ok, const QString &log) {
+        if (current != generation || !ok)
+            return;
+        QFile file(logFile);
+        if (file.open(QIODevice::WriteOnly))
+            file.write(log.toUtf8());
+        publish(log, sourceName);
+    });
+}
+
+void OptimizerRemarks::publish(const QString &log, const QString &sourceName) {
+    QVector<OptimizerRemark> remarks = parse(log, sourceName);
+    emit remarksReady(annotations(remarks), remarks.size());
+}
+
+QVector<OptimizerRemark> OptimizerRemarks::parse(const QString &log, const QString &sourceName) {
+    // main.cpp:12:23: optimized: loop vectorized using 32 byte vectors
+    static const QRegularExpression lineRe(R"(^(.*):(\d+):(\d+): (optimized|missed|note): (.*)$)",
+                                           QRegularExpression::MultilineOption);
+
+    QVector<OptimizerRemark> remarks;
+    QSet<QString> seen;
+    QRegularExpressionMatchIterator it = lineRe.globalMatch(log);
+    while (it.hasNext()) {
+        QRegularExpressionMatch match = it.next();
+        if (QFileInfo(match.captured(1)).fileName() != sourceName)
+            continue;
+
+        OptimizerRemark remark;
+        remark.line = match.captured(2).toInt();
+        remark.column = match.captured(3).toInt();
+        remark.kind = match.captured(4);
+        remark.message = match.captured(5).trimmed();
+
+        if (remark.kind == "note" && remark.message.contains("vectorized")) {
+            // GCC before 9 reports successes as notes too
+            remark.kind = "optimized";
+        }
+
+        // Vectorizer analysis chatter, only its conclusion is interesting
+        if (remark.kind == "note")
+            continue;
+
+        QString key = QString("%1:%2:%3").arg(remark.line).arg(remark.kind, remark.message);
+        if (seen.contains(key))
+            continue;
+        seen.insert(key);
+        remarks.append(remark);
+    }
+    return remarks;
+}
+
+QHash<int, LineAnnotation> OptimizerRemarks::annotations(const QVector<OptimizerRemark> &remarks) {
+    QHash<int, QVector<OptimizerRemark>> byLine;
+    for (const OptimizerRemark &remark : remarks)
+        byLine[remark.line].append(remark);
+
+    QHash<int, LineAnnotation> result;
+    for (auto it = byLine.cbegin(); it != byLine.cend(); ++it) {
+        bool vectorized = false, missed = false;
+        QStringList lines;
+        for (const OptimizerRemark &remark : it.value()) {
+            if (remark.kind == "missed")
+                missed = true;
+            else if (remark.message.contains("vectorized"))
+                vectorized = true;
+            if (lines.size() < 12)
+                lines << (remark.kind == "missed" ? "✗ " : "✓ ") + remark.message;
+        }
+        if (it.value().size() > lines.size())
+            lines << QString("... %1 not daha").arg(it.value().size() - lines.size());
+
+        // A vectorized loop wins over the missed attempts at other versions of it
+        LineAnnotation annotation;
+        if (vectorized) {
+            annotation.symbol = "▲";
+            annotation.color = QColor(78, 201, 176);
+        } else if (missed) {
+            annotation.symbol = "●";
+            annotation.color = QColor(206, 145, 120);
+        } else {
+            annotation.symbol = "ƒ";
+            annotation.color = QColor(86, 156, 214);
+        }
+        annotation.toolTip = lines.join('\n');
+        result.insert(it.key(), annotation);
+    }
+    return result;
+}
@@ -0,0 +1,43 @@
+#ifndef OPTIMIZERREMARKS_H
+#define OPTIMIZERREMARKS_H
+
+#include <QObject>
+#include <QHash>
+#include <QVector>
+#include "codeeditor.h"
+
+class BuildPipeline;
+
+struct OptimizerRemark {
+    int line = 0;
+    int column = 0;
+    QString kind;       // optimized, missed or note
+    QString message;
+};
+
+// Collects vectorization and inlining remarks for the buffer by compiling it
+// once more with GCC's -fopt-info next to the real build. Builds only ever
+// use gcc/g++, so Clang's -Rpass remarks are not handled.
+class OptimizerRemarks : public QObject {
+    Q_OBJECT
+
+public:
+    explicit OptimizerRemarks(QObject *parent = nullptr);
+
+    void collect(BuildPipeline *pipeline, const QString &language, const QString &code,
+                 const QStringList &flags);
+
+    static QStringList remarkFlags();
+    static QVector<OptimizerRemark> parse(const QString &log, const QString &sourceName);
+    static QHash<int, LineAnnotation> annotations(const QVector<OptimizerRemark> &remarks);
+
+signals:
+    void remarksReady(const QHash<int, LineAnnotation> &annotations, int count);
+
+private:
+    void publish(const QString &log, const QString &sourceName);
+
+    int generation = 0;
+};
+
+#endif // OPTIMIZERREMARKS_H
@@ -0,0 +1,264 @@
+#include "outputviewer.h"
+#include <QByteArrayMatcher>
+#include <QPainter>
+#include <QPaintEvent>
+#include <QScrollBar>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+// One index entry per this many lines
+static const qint64 linesPerCheckpoint = 1024;
+// Longest part of a single line that is drawn
+static const qint64 maxLineBytes = 4096;
+// Search window, keeps QByteArrayMatcher within int lengths
+static const qint64 searchChunk = 64 * 1024 * 1024;
+
+OutputViewer::OutputViewer(QWidget *parent) : QAbstractScrollArea(parent) {
+    setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    setStyleSheet("QAbstractScrollArea { background-color: #1e1e1e; border: none; }");
+    setFont(QFont("Consolas", 10));
+    checkpoints = {0};
+
+    liveTimer.setInterval(200);
+    connect(&liveTimer, &QTimer::timeout, this, &OutputViewer::refresh);
+}
+
+bool OutputViewer::openFile(const QString &path) {
+    closeFile();
+    file.setFileName(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    refresh();
+    return true;
+}
+
+void OutputViewer::closeFile() {
+    liveTimer.stop();
+    if (data)
+        file.unmap(data);
+    file.close();
+
+    data = nullptr;
+    mappedSize = 0;
+    indexedSize = 0;
+    lines = 0;
+    newlines = 0;
+    matchLine = -1;
+    checkpoints = {0};
+    updateScrollBars();
+    viewport()->update();
+}
+
+void OutputViewer::setLive(bool live) {
+    if (live) {
+        liveTimer.start();
+    } else {
+        liveTimer.stop();
+        refresh();
+    }
+}
+
+void OutputViewer::setFollowTail(bool follow) {
+    followTail = follow;
+    if (followTail)
+        verticalScrollBar()->setValue(verticalScrollBar()->maximum());
+}
+
+void OutputViewer::refresh() {
+    if (!file.isOpen())
+        return;
+
+    qint64 size = file.size();
+    if (size == mappedSize)
+        return;
+
+    if (size < mappedSize) {
+        // The file was truncated, index it again from the start
+        indexedSize = 0;
+        newlines = 0;
+        checkpoints = {0};
+    }
+
+    if (data)
+        file.unmap(data);
+    data = size > 0 ? file.map(0, size) : nullptr;
+    mappedSize = data ? size : 0;
+
+    indexFrom(indexedSize);
+    updateScrollBars();
+    if (followTail)
+        verticalScrollBar()->setValue(verticalScrollBar()->maximum());
+    viewport()->update();
+
+    emit statusChanged(QString("%1 satır, %2 bayt").arg(lines).arg(mappedSize));
+}
+
+void OutputViewer::indexFrom(qint64 offset) {
+    const char *base = reinterpret_cast<const char *>(data);
+    qint64 pos = offset;
+    while (pos < mappedSize) {
+        const void *hit = std::memchr(base + pos, '\n', size_t(mappedSize - pos));
+        if (!hit)
+            break;
+        pos = static_cast<const char *>(hit) - base + 1;
+        if (++newlines % linesPerCheckpoint == 0)
+            checkpoints.append(pos);
+    }
+    indexedSize = mappedSize;
+
+    bool partialLastLine = mappedSize > 0 && base[mappedSize - 1] != '\n';
+    lines = newlines + (partialLastLine ? 1 : 0);
+}
+
+qint64 OutputViewer::lineOffset(qint64 line) const {
+    if (line <= 0 || checkpoints.isEmpty())
+        return 0;
+
+    qint64 block = qMin<qint64>(line / linesPerCheckpoint, checkpoints.size() - 1);
+    qint64 offset = checkpoints[int(block)];
+    qint64 remaining = line - block * linesPerCheckpoint;
+    const char *base = reinterpret_cast<const char *>(data);
+    while (remaining > 0 && offset < mappedSize) {
+        const void *hit = std::memchr(base + offset, '\n', size_t(mappedSize - offset));
+        if (!hit)
+            return mappedSize;
+        offset = static_cast<const char *>(hit) - base + 1;
+        --remaining;
+    }
+    return offset;
+}
+
+qint64 OutputViewer::lineAt(qint64 offset) const {
+    auto it = std::upper_bound(checkpoints.cbegin(), checkpoints.cend(), offset);
+    qint64 block = qMax<qint64>(0, (it - checkpoints.cbegin()) - 1);
+    qint64 line = block * linesPerCheckpoint;
+    qint64 pos = checkpoints.isEmpty() ? 0 : checkpoints[int(block)];
+    const char *base = reinterpret_cast<const char *>(data);
+    while (pos < offset) {
+        const void *hit = std::memchr(base + pos, '\n', size_t(offset - pos));
+        if (!hit)
+            break;
+        pos = static_cast<const char *>(hit) - base + 1;
+        ++line;
+    }
+    return line;
+}
+
+qint64 OutputViewer::lineEnd(qint64 offset) const {
+    if (offset >= mappedSize)
+        return mappedSize;
+    const char *base = reinterpret_cast<const char *>(data);
+    const void *hit = std::memchr(base + offset, '\n', size_t(mappedSize - offset));
+    return hit ? static_cast<const char *>(hit) - base : mappedSize;
+}
+
+qint64 OutputViewer::topLine() const {
+    return qint64(verticalScrollBar()->value()) * scrollUnit;
+}
+
+int OutputViewer::visibleLines() const {
+    return qMax(1, viewport()->height() / fontMetrics().height());
+}
+
+void OutputViewer::updateScrollBars() {
+    qint64 maxTop = qMax<qint64>(0, lines - visibleLines());
+    // Scroll bars are int based; step several lines at a time past INT_MAX lines
+    scrollUnit = maxTop / INT_MAX + 1;
+    verticalScrollBar()->setRange(0, int(maxTop / scrollUnit));
+    verticalScrollBar()->setPageStep(visibleLines());
+    verticalScrollBar()->setSingleStep(3);
+}
+
+bool OutputViewer::find(const QString &text) {
+    if (!data || text.isEmpty())
+        return false;
+
+    QByteArray needle = text.toUtf8();
+    QByteArrayMatcher matcher(needle);
+    const char *base = reinterpret_cast<const char *>(data);
+
+    auto search = [&](qint64 from, qint64 to) -> qint64 {
+        for (qint64 pos = from; pos < to; pos += searchChunk) {
+            qint64 length = qMin<qint64>(searchChunk + needle.size() - 1, to - pos);
+            int hit = matcher.indexIn(base + pos, int(length), 0);
+            if (hit >= 0)
+                return pos + hit;
+        }
+        return -1;
+    };
+
+    qint64 start = lineOffset(matchLine >= 0 ? matchLine + 1 : topLine());
+    qint64 found = search(start, mappedSize);
+    if (found < 0)
+        found = search(0, start);
+
+    if (found < 0) {
+        emit statusChanged("Bulunamadı: " + text);
+        return false;
+    }
+
+    matchLine = lineAt(found);
+    followTail = false;
+    goToLine(matchLine);
+    emit statusChanged(QString("Satır %1").arg(matchLine + 1));
+    return true;
+}
+
+void OutputViewer::goToLine(qint64 line) {
+    line = qBound<qint64>(0, line, qMax<qint64>(0, lines - 1));
+    // Keep a little context above the target line
+    qint64 top = qMax<qint64>(0, line - visibleLines() / 3);
+    verticalScrollBar()->setValue(int(top / scrollUnit));
+    viewport()->update();
+}
+
+void OutputViewer::paintEvent(QPaintEvent *event) {
+    QPainter painter(viewport());
+    painter.fillRect(event->rect(), QColor(30, 30, 30));
+    if (!data)
+        return;
+
+    QFontMetrics metrics = fontMetrics();
+    int lineHeight = metrics.height();
+    int gutter = 10 + metrics.horizontalAdvance(QString::number(lines));
+    painter.fillRect(0, 0, gutter, viewport()->height(), QColor(37, 37, 38));
+
+    const char *base = reinterpret_cast<const char *>(data);
+    qint64 line = topLine();
+    qint64 offset = lineOffset(line);
+    int rows = visibleLines() + 1;
+
+    for (int row = 0; row < rows && line < lines; ++row, ++line) {
+        int y = row * lineHeight;
+        qint64 end = lineEnd(offset);
+
+        if (line == matchLine)
+            painter.fillRect(gutter, y, viewport()->width() - gutter, lineHeight, QColor(38, 79, 120));
+
+        painter.setPen(QColor(128, 128, 128));
+        painter.drawText(0, y, gutter - 5, lineHeight, Qt::AlignRight, QString::number(line + 1));
+
+        qint64 length = qMin(end - offset, maxLineBytes);
+        QString text = QString::fromUtf8(base + offset, int(length));
+        if (text.endsWith('\r'))
+            text.chop(1);
+        painter.setPen(QColor(212, 212, 212));
+        painter.drawText(gutter + 5, y, viewport()->width() - gutter - 5, lineHeight,
+                         Qt::AlignLeft | Qt::TextExpandTabs, text);
+
+        offset = end + 1;
+    }
+}
+
+void OutputViewer::resizeEvent(QResizeEvent *event) {
+    QAbstractScrollArea::resizeEvent(event);
+    updateScrollBars();
+}
+
+void OutputViewer::scrollContentsBy(int dx, int dy) {
+    Q_UNUSED(dx);
+    Q_UNUSED(dy);
+    viewport()->update();
+}
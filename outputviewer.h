@@ -0,0 +1,60 @@
+#ifndef OUTPUTVIEWER_H
+#define OUTPUTVIEWER_H
+
+#include <QAbstractScrollArea>
+#include <QFile>
+#include <QTimer>
+#include <QVector>
+
+// Read-only viewer for very large program output. The file is memory-mapped
+// and only a sparse line index (one offset per block of lines) is kept, so
+// memory use stays flat no matter how big the output gets.
+class OutputViewer : public QAbstractScrollArea {
+    Q_OBJECT
+
+public:
+    explicit OutputViewer(QWidget *parent = nullptr);
+
+    bool openFile(const QString &path);
+    void closeFile();
+    void setLive(bool live);
+    void setFollowTail(bool follow);
+
+    bool find(const QString &text);
+    void goToLine(qint64 line);
+    qint64 lineCount() const { return lines; }
+
+signals:
+    void statusChanged(const QString &status);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void scrollContentsBy(int dx, int dy) override;
+
+private slots:
+    void refresh();
+
+private:
+    void indexFrom(qint64 offset);
+    qint64 lineOffset(qint64 line) const;
+    qint64 lineAt(qint64 offset) const;
+    qint64 lineEnd(qint64 offset) const;
+    qint64 topLine() const;
+    int visibleLines() const;
+    void updateScrollBars();
+
+    QFile file;
+    uchar *data = nullptr;
+    qint64 mappedSize = 0;
+    qint64 indexedSize = 0;
+    qint64 lines = 0;
+    qint64 newlines = 0;
+    QVector<qint64> checkpoints;
+    qint64 scrollUnit = 1;
+    qint64 matchLine = -1;
+    bool followTail = true;
+    QTimer liveTimer;
+};
+
+#endif // OUTPUTVIEWER_H
@@ -0,0 +1,356 @@
+#include "pgopanel.h"
+#include "benchmarkrunner.h"
+#include <QCheckBox>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QTableWidget>
+#include <QVBoxLayout>
+
+// Job tags
+static const int warmupTag = -1;
+static const int trainingTag = -2;
+static const int plainTag = 0;
+static const int optimizedTag = 1;
+
+PgoPanel::PgoPanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+
+    retrainCheck = new QCheckBox("Profili yeniden eğit");
+    retrainCheck->setStyleSheet("QCheckBox { color: #cccccc; }");
+    retrainCheck->setToolTip("Kayıtlı profil yerine eğitim girdisiyle yeni profil topla");
+
+    repeatSpin = new QSpinBox();
+    repeatSpin->setRange(2, 50);
+    repeatSpin->setValue(5);
+    repeatSpin->setSuffix(" tekrar");
+
+    startButton = new QPushButton("▶ PGO Derle ve Ölç");
+    connect(startButton, &QPushButton::clicked, this, [this]() {
+        if (!isRunning())
+            emit runRequested();
+    });
+    stopButton = new QPushButton("■ Durdur");
+    stopButton->setEnabled(false);
+    connect(stopButton, &QPushButton::clicked, this, &PgoPanel::stop);
+
+    bar->addWidget(retrainCheck);
+    bar->addWidget(repeatSpin);
+    bar->addWidget(startButton);
+    bar->addWidget(stopButton);
+    bar->addStretch();
+
+    statusLabel = new QLabel("Hazır");
+    statusLabel->setStyleSheet("QLabel { color: #cccccc; }");
+    statusLabel->setWordWrap(true);
+    statusLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+
+    table = new QTableWidget(0, 4);
+    table->setHorizontalHeaderLabels({"Derleme", "Medyan (ms)", "Ortalama ± %95 GA", "Hızlanma"});
+    table->horizontalHeader()->setStretchLastSection(true);
+    table->verticalHeader()->setVisible(false);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                         "gridline-color: #454545; border: none; }"
+                         "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                         "border: none; padding: 3px; }");
+
+    layout->addLayout(bar);
+    layout->addWidget(statusLabel);
+    layout->addWidget(table);
+
+    runner = new BenchmarkRunner(this);
+    connect(runner, &BenchmarkRunner::jobFinished, this, &PgoPanel::onJobFinished);
+    connect(runner, &BenchmarkRunner::allFinished, this, &PgoPanel::onAllFinished);
+    connect(runner, &BenchmarkRunner::progress, this, [this](int done, int total) {
+        if (phase == Benchmarking)
+            statusLabel->setText(QString("Ölçülüyor: %1/%2").arg(done).arg(total));
+    });
+}
+
+bool PgoPanel::isRunning() const {
+    return phase != Idle;
+}
+
+void PgoPanel::showError(const QString &message) {
+    statusLabel->setText(message);
+}
+
+void PgoPanel::setRunning(bool running) {
+    startButton->setEnabled(!running);
+    stopButton->setEnabled(running);
+}
+
+void PgoPanel::fail(const QString &message) {
+    phase = Idle;
+    setRunning(false);
+    statusLabel->setText(message);
+}
+
+void PgoPanel::stop() {
+    if (phase == Idle)
+        return;
+    // Steps still in flight report into a stale generation and are ignored
+    ++generation;
+    phase = Idle;
+    runner->cancel();
+    setRunning(false);
+    statusLabel->setText("Durduruldu");
+}
+
+QString PgoPanel::profileFile() const {
+    // A separate -c step names the object, and with it the .gcda, the same
+    // way in both builds
+    return profileDir + "/main.gcda";
+}
+
+void PgoPanel::start(BuildPipeline *pipeline, const QString &language, const QString &code,
+                     const QStringList &flags, const QString &inputFile, const QString &runDir) {
+    if (isRunning())
+        return;
+    if (!BuildPipeline::isCompiled(language)) {
+        showError("Hata: PGO yalnızca C ve C++ için kullanılabilir!");
+        return;
+    }
+
+    this->pipeline = pipeline;
+    this->language = language;
+    this->flags = flags;
+    this->inputFile = inputFile;
+    this->runDir = runDir;
+    plain = RunTarget();
+    optimized = RunTarget();
+    trained = false;
+    plainTimes.clear();
+    optimizedTimes.clear();
+    table->setRowCount(0);
+
+    // The profile only matches a build with the flags it was trained with,
+    // GCC rejects it otherwise (-Werror=coverage-mismatch)
+    QString key = BuildPipeline::sourceKey(language, flags.join('\n') + '\n' + code);
+    profileDir = QDir(pipeline->rootDir()).filePath("pgo-" + key);
+    source = profileDir + "/main" + BuildPipeline::sourceSuffix(language);
+    QDir().mkpath(profileDir);
+    QFile file(source);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        showError("Hata: Dosya oluşturulamadı!");
+        return;
+    }
+    file.write(code.toUtf8());
+    file.close();
+
+    phase = Building;
+    setRunning(true);
+    statusLabel->setText("Normal derleme...");
+
+    int current = ++generation;
+    pipeline->build(language, code, flags, [this, current](const RunTarget &target, const QString &log) {
+        if (current != generation)
+            return;
+        if (!target.isValid()) {
+            fail("✗ Derleme hatası:\n" + log);
+            return;
+        }
+        plain = target;
+        if (retrainCheck->isChecked() || !QFileInfo::exists(profileFile()))
+            train();
+        else
+            buildOptimized();
+    });
+}
+
+void PgoPanel::train() {
+    // Old profile and the binaries built from it are stale now
+    QDir dir(profileDir);
+    for (const QString &name : dir.entryList({"main.gcda", "optimized-*"}, QDir::Files))
+        dir.remove(name);
+
+    statusLabel->setText("Ölçümlü derleme (-fprofile-generate)...");
+    int current = generation;
+    QString object = profileDir + "/main.o";
+    QString program = profileDir + "/train";
+
+    QStringList compile;
+    compile << "-c" << source << flags << "-fprofile-generate" << "-o" << object;
+    pipeline->runStep(BuildPipeline::compiler(language), compile,
+                      [this, current, object, program](bool ok, const QString &log) {
+        if (current != generation)
+            return;
+        if (!ok) {
+            fail("✗ Ölçümlü derleme hatası:\n" + log);
+            return;
+        }
+
+        QStringList link;
+        link << object << flags << "-fprofile-generate" << "-o" << program;
+        pipeline->runStep(BuildPipeline::compiler(language), link,
+                          [this, current, program](bool ok, const QString &log) {
+            if (current != generation)
+                return;
+            if (!ok) {
+                fail("✗ Ölçümlü bağlama hatası:\n" + log);
+                return;
+            }
+
+            phase = Training;
+            statusLabel->setText("Eğitim girdisiyle çalıştırılıyor...");
+            BenchmarkJob job;
+            job.target.program = program;
+            job.inputFile = inputFile;
+            job.tag = trainingTag;
+            runner->reset(runDir);
+            runner->enqueue(job);
+            runner->start();
+        });
+    });
+}
+
+void PgoPanel::buildOptimized() {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(flags.join('\n').toUtf8());
+    QString program = profileDir + "/optimized-" + QString::fromLatin1(hash.result().toHex().left(16));
+
+    if (QFileInfo::exists(program)) {
+        optimized.program = program;
+        startBenchmarks();
+        return;
+    }
+
+    phase = Building;
+    statusLabel->setText("Profille derleniyor (-fprofile-use)...");
+    int current = generation;
+    QString object = profileDir + "/main.o";
+
+    // -fprofile-correction tolerates counters from multithreaded training runs
+    QStringList compile;
+    compile << "-c" << source << flags << "-fprofile-use" << "-fprofile-correction" << "-o" << object;
+    pipeline->runStep(BuildPipeline::compiler(language), compile,
+                      [this, current, object, program](bool ok, const QString &log) {
+        if (current != generation)
+            return;
+        if (!ok) {
+            fail("✗ Profilli derleme hatası:\n" + log);
+            return;
+        }
+
+        QStringList link;
+        link << object << flags << "-o" << program;
+        pipeline->runStep(BuildPipeline::compiler(language), link,
+                          [this, current, program](bool ok, const QString &log) {
+            if (current != generation)
+                return;
+            if (!ok) {
+                fail("✗ Profilli bağlama hatası:\n" + log);
+                return;
+            }
+            optimized.program = program;
+            startBenchmarks();
+        });
+    });
+}
+
+void PgoPanel::startBenchmarks() {
+    phase = Benchmarking;
+    runner->reset(runDir);
+
+    BenchmarkJob job;
+    job.inputFile = inputFile;
+
+    job.tag = warmupTag;
+    job.target = plain;
+    runner->enqueue(job);
+    job.target = optimized;
+    runner->enqueue(job);
+
+    // Interleaved so both builds see the same machine state
+    for (int round = 0; round < repeatSpin->value(); ++round) {
+        job.tag = plainTag;
+        job.target = plain;
+        runner->enqueue(job);
+        job.tag = optimizedTag;
+        job.target = optimized;
+        runner->enqueue(job);
+    }
+    runner->start();
+}
+
+void PgoPanel::onJobFinished(int index, const RunStats &stats) {
+    int tag = runner->job(index).tag;
+    if (tag == trainingTag) {
+        trained = stats.valid && stats.signal == 0;
+        return;
+    }
+    if (tag == warmupTag)
+        return;
+    if (!stats.valid || stats.exitCode != 0 || stats.signal != 0) {
+        phase = Idle;
+        runner->cancel();
+        setRunning(false);
+        statusLabel->setText(QString("Hata: %1 çalıştırma başarısız (%2)")
+                                 .arg(tag == plainTag ? "Normal" : "PGO").arg(stats.summary()));
+        return;
+    }
+    (tag == plainTag ? plainTimes : optimizedTimes).append(stats.wallMs);
+}
+
+void PgoPanel::onAllFinished() {
+    if (phase == Training) {
+        // The counters are written when the program exits normally
+        if (!trained || !QFileInfo::exists(profileFile())) {
+            fail("Hata: Eğitim çalıştırması profil üretmedi (program çöktü mü?)");
+            return;
+        }
+        buildOptimized();
+        return;
+    }
+    if (phase != Benchmarking)
+        return;
+
+    phase = Idle;
+    setRunning(false);
+    if (plainTimes.isEmpty() || optimizedTimes.isEmpty()) {
+        statusLabel->setText("Durduruldu");
+        return;
+    }
+
+    double plainMedian = BenchmarkRunner::median(plainTimes);
+    double optimizedMedian = BenchmarkRunner::median(optimizedTimes);
+    double speedup = optimizedMedian > 0 ? plainMedian / optimizedMedian : 0;
+
+    const QVector<double> *series[] = {&plainTimes, &optimizedTimes};
+    const QStringList names = {"Normal (" + flags.join(' ') + ")", "PGO"};
+    table->setRowCount(2);
+    for (int row = 0; row < 2; ++row) {
+        const QVector<double> &times = *series[row];
+        double median = BenchmarkRunner::median(times);
+        QStringList values;
+        values << names[row]
+               << QString::number(median, 'f', 2)
+               << QString("%1 ± %2").arg(BenchmarkRunner::mean(times), 0, 'f', 2)
+                                    .arg(BenchmarkRunner::confidence95(times), 0, 'f', 2)
+               << (median > 0 ? QString::number(plainMedian / median, 'f', 2) + "x" : "-");
+        for (int column = 0; column < values.size(); ++column)
+            table->setItem(row, column, new QTableWidgetItem(values[column]));
+    }
+
+    // Overlapping intervals mean the difference may just be noise
+    double plainHigh = BenchmarkRunner::mean(plainTimes) + BenchmarkRunner::confidence95(plainTimes);
+    double plainLow = BenchmarkRunner::mean(plainTimes) - BenchmarkRunner::confidence95(plainTimes);
+    double optimizedHigh = BenchmarkRunner::mean(optimizedTimes) + BenchmarkRunner::confidence95(optimizedTimes);
+    double optimizedLow = BenchmarkRunner::mean(optimizedTimes) - BenchmarkRunner::confidence95(optimizedTimes);
+    bool significant = optimizedHigh < plainLow || optimizedLow > plainHigh;
+
+    statusLabel->setText(QString("PGO hızlanması: %1x%2 | profil: %3")
+                             .arg(speedup, 0, 'f', 2)
+                             .arg(significant ? "" : " (güven aralıkları çakışıyor, fark anlamlı değil)")
+                             .arg(trained ? "yeni eğitildi" : "önbellekten"));
+}
@@ -0,0 +1,72 @@
+#ifndef PGOPANEL_H
+#define PGOPANEL_H
+
+#include <QWidget>
+#include <QVector>
+#include "buildpipeline.h"
+#include "runstats.h"
+
+class BenchmarkRunner;
+class QCheckBox;
+class QLabel;
+class QPushButton;
+class QSpinBox;
+class QTableWidget;
+
+// Profile-guided optimization in one go: instrumented build, training run,
+// -fprofile-use rebuild, then a benchmark against the plain build. The
+// profile is kept per source hash, so changing only the flags reuses it.
+class PgoPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit PgoPanel(QWidget *parent = nullptr);
+
+    void start(BuildPipeline *pipeline, const QString &language, const QString &code,
+               const QStringList &flags, const QString &inputFile, const QString &runDir);
+    void showError(const QString &message);
+    bool isRunning() const;
+
+signals:
+    void runRequested();
+
+private slots:
+    void onJobFinished(int index, const RunStats &stats);
+    void onAllFinished();
+    void stop();
+
+private:
+    enum Phase { Idle, Building, Training, Benchmarking };
+
+    void train();
+    void buildOptimized();
+    void startBenchmarks();
+    void fail(const QString &message);
+    void setRunning(bool running);
+    QString profileFile() const;
+
+    QCheckBox *retrainCheck;
+    QSpinBox *repeatSpin;
+    QPushButton *startButton;
+    QPushButton *stopButton;
+    QLabel *statusLabel;
+    QTableWidget *table;
+
+    BenchmarkRunner *runner;
+    BuildPipeline *pipeline = nullptr;
+    Phase phase = Idle;
+    int generation = 0;
+    QString language;
+    QString source;
+    QString profileDir;
+    QStringList flags;
+    QString inputFile;
+    QString runDir;
+    RunTarget plain;
+    RunTarget optimized;
+    bool trained = false;
+    QVector<double> plainTimes;
+    QVector<double> optimizedTimes;
+};
+
+#endif // PGOPANEL_H
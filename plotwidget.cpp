@@ -0,0 +1,186 @@
+#include "plotwidget.h"
+#include <QPainter>
+#include <QPainterPath>
+#include <cmath>
+
+PlotWidget::PlotWidget(QWidget *parent) : QWidget(parent) {
+    setMinimumSize(240, 160);
+}
+
+void PlotWidget::setTitle(const QString &text) {
+    title = text;
+    update();
+}
+
+void PlotWidget::setAxisLabels(const QString &x, const QString &y) {
+    xLabel = x;
+    yLabel = y;
+    update();
+}
+
+void PlotWidget::setLogScale(bool logXAxis, bool logYAxis) {
+    logX = logXAxis;
+    logY = logYAxis;
+    update();
+}
+
+void PlotWidget::clear() {
+    series.clear();
+    update();
+}
+
+int PlotWidget::addSeries(const QString &name, const QColor &color, bool dashed) {
+    Series s;
+    s.name = name;
+    s.color = color;
+    s.dashed = dashed;
+    series.append(s);
+    return series.size() - 1;
+}
+
+void PlotWidget::setPoints(int index, const QVector<QPointF> &points) {
+    if (index < 0 || index >= series.size())
+        return;
+    series[index].points = points;
+    update();
+}
+
+void PlotWidget::appendPoint(int index, const QPointF &point) {
+    if (index < 0 || index >= series.size())
+        return;
+    series[index].points.append(point);
+    update();
+}
+
+double PlotWidget::mapX(double x) const {
+    return logX ? std::log10(x) : x;
+}
+
+double PlotWidget::mapY(double y) const {
+    return logY ? std::log10(y) : y;
+}
+
+QString PlotWidget::formatTick(double value) {
+    double magnitude = std::fabs(value);
+    if (magnitude >= 1e6 || (magnitude > 0 && magnitude < 1e-2))
+        return QString::number(value, 'g', 2);
+    if (magnitude >= 100)
+        return QString::number(value, 'f', 0);
+    return QString::number(value, 'g', 3);
+}
+
+void PlotWidget::paintEvent(QPaintEvent *event) {
+    Q_UNUSED(event);
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.fillRect(rect(), QColor(30, 30, 30));
+
+    const int left = 60, right = 15, top = title.isEmpty() ? 15 : 30, bottom = 40;
+    QRectF area(left, top, width() - left - right, height() - top - bottom);
+    if (area.width() <= 10 || area.height() <= 10)
+        return;
+
+    painter.setPen(QColor(204, 204, 204));
+    if (!title.isEmpty())
+        painter.drawText(QRectF(0, 5, width(), 20), Qt::AlignCenter, title);
+
+    // Data bounds in plotted (possibly logarithmic) coordinates
+    bool any = false;
+    double minX = 0, maxX = 1, minY = 0, maxY = 1;
+    for (const Series &s : series) {
+        for (const QPointF &p : s.points) {
+            if ((logX && p.x() <= 0) || (logY && p.y() <= 0))
+                continue;
+            double x = mapX(p.x()), y = mapY(p.y());
+            if (!any) {
+                minX = maxX = x;
+                minY = maxY = y;
+                any = true;
+            }
+            minX = qMin(minX, x); maxX = qMax(maxX, x);
+            minY = qMin(minY, y); maxY = qMax(maxY, y);
+        }
+    }
+    if (!logY && any)
+        minY = qMin(minY, 0.0);
+    if (maxX - minX < 1e-12) maxX = minX + 1;
+    if (maxY - minY < 1e-12) maxY = minY + 1;
+
+    auto toScreen = [&](const QPointF &p) {
+        double x = area.left() + (mapX(p.x()) - minX) / (maxX - minX) * area.width();
+        double y = area.bottom() - (mapY(p.y()) - minY) / (maxY - minY) * area.height();
+        return QPointF(x, y);
+    };
+
+    // Grid and ticks
+    const int ticks = 5;
+    QPen gridPen(QColor(62, 62, 66));
+    for (int i = 0; i <= ticks; ++i) {
+        double fx = minX + (maxX - minX) * i / ticks;
+        double fy = minY + (maxY - minY) * i / ticks;
+        double sx = area.left() + area.width() * i / ticks;
+        double sy = area.bottom() - area.height() * i / ticks;
+
+        painter.setPen(gridPen);
+        painter.drawLine(QPointF(sx, area.top()), QPointF(sx, area.bottom()));
+        painter.drawLine(QPointF(area.left(), sy), QPointF(area.right(), sy));
+
+        painter.setPen(QColor(150, 150, 150));
+        painter.drawText(QRectF(sx - 40, area.bottom() + 2, 80, 16), Qt::AlignCenter,
+                         formatTick(logX ? std::pow(10.0, fx) : fx));
+        painter.drawText(QRectF(0, sy - 8, left - 5, 16), Qt::AlignRight | Qt::AlignVCenter,
+                         formatTick(logY ? std::pow(10.0, fy) : fy));
+    }
+
+    painter.setPen(QColor(204, 204, 204));
+    painter.drawText(QRectF(area.left(), height() - 20, area.width(), 18), Qt::AlignCenter, xLabel);
+    painter.save();
+    painter.translate(12, area.center().y());
+    painter.rotate(-90);
+    painter.drawText(QRectF(-area.height() / 2, -8, area.height(), 16), Qt::AlignCenter, yLabel);
+    painter.restore();
+
+    // Series
+    painter.setClipRect(area.adjusted(-4, -4, 4, 4));
+    for (const Series &s : series) {
+        QPen pen(s.color, 2);
+        if (s.dashed)
+            pen.setStyle(Qt::DashLine);
+        painter.setPen(pen);
+
+        QPainterPath path;
+        bool first = true;
+        for (const QPointF &p : s.points) {
+            if ((logX && p.x() <= 0) || (logY && p.y() <= 0))
+                continue;
+            QPointF sp = toScreen(p);
+            if (first) path.moveTo(sp);
+            else path.lineTo(sp);
+            first = false;
+        }
+        painter.drawPath(path);
+
+        if (!s.dashed && s.points.size() <= 64) {
+            painter.setBrush(s.color);
+            for (const QPointF &p : s.points) {
+                if ((logX && p.x() <= 0) || (logY && p.y() <= 0))
+                    continue;
+                painter.drawEllipse(toScreen(p), 3, 3);
+            }
+            painter.setBrush(Qt::NoBrush);
+        }
+    }
+    painter.setClipping(false);
+
+    // Legend
+    int legendY = int(area.top()) + 4;
+    for (const Series &s : series) {
+        if (s.name.isEmpty())
+            continue;
+        painter.setPen(QPen(s.color, 2));
+        painter.drawLine(int(area.left()) + 8, legendY + 7, int(area.left()) + 24, legendY + 7);
+        painter.setPen(QColor(204, 204, 204));
+        painter.drawText(int(area.left()) + 30, legendY + 12, s.name);
+        legendY += 16;
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef PLOTWIDGET_H
+#define PLOTWIDGET_H
+
+#include <QWidget>
+#include <QColor>
+#include <QPointF>
+#include <QVector>
+
+// Minimal line chart painted with QPainter, shared by the analysis panels
+class PlotWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit PlotWidget(QWidget *parent = nullptr);
+
+    void setTitle(const QString &text);
+    void setAxisLabels(const QString &x, const QString &y);
+    void setLogScale(bool logX, bool logY);
+
+    void clear();
+    int addSeries(const QString &name, const QColor &color, bool dashed = false);
+    void setPoints(int series, const QVector<QPointF> &points);
+    void appendPoint(int series, const QPointF &point);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    struct Series {
+        QString name;
+        QColor color;
+        bool dashed;
+        QVector<QPointF> points;
+    };
+
+    double mapX(double x) const;
+    double mapY(double y) const;
+    static QString formatTick(double value);
+
+    QString title;
+    QString xLabel;
+    QString yLabel;
+    bool logX = false;
+    bool logY = false;
+    QVector<Series> series;
+};
+
+#endif // PLOTWIDGET_H
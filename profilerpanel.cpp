@@ -0,0 +1,697 @@
+#include "profilerpanel.h"
+#include "flamegraph.h"
+#include "symbolizer.h"
+#include <QComboBox>
+#include <QFile>
+#include <QFileInfo>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QProcess>
+#include <QProcessEnvironment>
+#include <QPushButton>
+#include <QRegularExpression>
+#include <QScrollArea>
+#include <QSet>
+#include <QSpinBox>
+#include <QSplitter>
+#include <QStandardPaths>
+#include <QTableWidget>
+#include <QVBoxLayout>
+#include <algorithm>
+
+// Preloaded into the profiled program. SIGPROF fires every 1/hz of CPU
+// time, the handler unwinds through .eh_frame into a preallocated buffer,
+// and at exit every sample is written as one line of frames, leaf first:
+// "@<link address>" inside the executable, a symbol name elsewhere.
+static const char samplerSource[] = R"SAMPLER(
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <link.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <ucontext.h>
+#include <unwind.h>
+
+#define MAX_DEPTH 64
+#define RECORD (MAX_DEPTH + 1)
+#define SLOTS (1 << 22)
+
+static uintptr_t buffer[SLOTS];
+static size_t used;
+static int enabled;
+static char output[4096];
+
+struct unwind_state {
+    uintptr_t *frames;
+    size_t depth;
+    uintptr_t pc;
+    int started;
+};
+
+static _Unwind_Reason_Code collect_frame(struct _Unwind_Context *context, void *data) {
+    struct unwind_state *state = (struct unwind_state *)data;
+    uintptr_t ip = (uintptr_t)_Unwind_GetIP(context);
+    /* Skip the handler and the signal trampoline, start at the interrupted pc */
+    if (!state->started) {
+        if (ip != state->pc)
+            return _URC_NO_REASON;
+        state->started = 1;
+    }
+    if (state->depth >= MAX_DEPTH || !ip)
+        return _URC_END_OF_STACK;
+    state->frames[state->depth++] = ip;
+    return _URC_NO_REASON;
+}
+
+static void on_sample(int sig, siginfo_t *info, void *context) {
+    (void)sig;
+    (void)info;
+    ucontext_t *uc = (ucontext_t *)context;
+    uintptr_t pc;
+#if defined(__x86_64__)
+    pc = (uintptr_t)uc->uc_mcontext.gregs[REG_RIP];
+#elif defined(__aarch64__)
+    pc = (uintptr_t)uc->uc_mcontext.pc;
+#else
+    return;
+#endif
+    size_t start = __atomic_fetch_add(&used, RECORD, __ATOMIC_RELAXED);
+    if (start + RECORD > SLOTS)
+        return;
+
+    struct unwind_state state = { &buffer[start + 1], 0, pc, 0 };
+    _Unwind_Backtrace(collect_frame, &state);
+    if (!state.started)
+        buffer[start + 1 + state.depth++] = pc;
+    buffer[start] = state.depth;
+}
+
+__attribute__((constructor)) static void start_sampler(void) {
+    const char *path = getenv("CODEIDE_PROFILE_OUT");
+    if (!path || strlen(path) >= sizeof(output))
+        return;
+    strcpy(output, path);
+    const char *rate = getenv("CODEIDE_PROFILE_HZ");
+    int hz = rate ? atoi(rate) : 999;
+    if (hz <= 0 || hz > 100000)
+        hz = 999;
+    /* Programs started by the profiled one are not sampled */
+    unsetenv("CODEIDE_PROFILE_OUT");
+    unsetenv("LD_PRELOAD");
+
+    struct sigaction action;
+    memset(&action, 0, sizeof action);
+    action.sa_sigaction = on_sample;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGPROF, &action, NULL);
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = 1000000 / hz;
+    timer.it_value = timer.it_interval;
+    setitimer(ITIMER_PROF, &timer, NULL);
+    enabled = 1;
+}
+
+struct main_object {
+    uintptr_t bias;
+    uintptr_t start[16];
+    uintptr_t end[16];
+    int count;
+};
+
+static int find_main(struct dl_phdr_info *info, size_t size, void *data) {
+    (void)size;
+    struct main_object *object = (struct main_object *)data;
+    object->bias = info->dlpi_addr;
+    for (int i = 0; i < info->dlpi_phnum && object->count < 16; ++i) {
+        if (info->dlpi_phdr[i].p_type != PT_LOAD)
+            continue;
+        object->start[object->count] = info->dlpi_addr + info->dlpi_phdr[i].p_vaddr;
+        object->end[object->count] = object->start[object->count] + info->dlpi_phdr[i].p_memsz;
+        ++object->count;
+    }
+    return 1; /* the executable always comes first */
+}
+
+__attribute__((destructor)) static void write_samples(void) {
+    if (!enabled)
+        return;
+    enabled = 0;
+    struct itimerval off;
+    memset(&off, 0, sizeof off);
+    setitimer(ITIMER_PROF, &off, NULL);
+    signal(SIGPROF, SIG_IGN);
+
+    FILE *file = fopen(output, "w");
+    if (!file)
+        return;
+    struct main_object executable;
+    memset(&executable, 0, sizeof executable);
+    dl_iterate_phdr(find_main, &executable);
+
+    size_t end = used < SLOTS ? used : SLOTS;
+    for (size_t i = 0; i + RECORD <= end; i += RECORD) {
+        size_t depth = buffer[i];
+        for (size_t d = 0; d < depth; ++d) {
+            uintptr_t address = buffer[i + 1 + d];
+            int inside = 0;
+            for (int s = 0; s < executable.count; ++s)
+                inside |= address >= executable.start[s] && address < executable.end[s];
+            if (d)
+                fputc('\t', file);
+
+            Dl_info symbol;
+            memset(&symbol, 0, sizeof symbol);
+            if (inside) {
+                fprintf(file, "@%lx", (unsigned long)(address - executable.bias));
+            } else if (dladdr((void *)address, &symbol) && symbol.dli_sname) {
+                fputs(symbol.dli_sname, file);
+            } else if (symbol.dli_fname && *symbol.dli_fname) {
+                const char *slash = strrchr(symbol.dli_fname, '/');
+                fprintf(file, "[%s]", slash ? slash + 1 : symbol.dli_fname);
+            } else {
+                fputs("[?]", file);
+            }
+        }
+        if (depth)
+            fputc('\n', file);
+    }
+    fclose(file);
+}
+)SAMPLER";
+
+ProfilerPanel::ProfilerPanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+
+    methodCombo = new QComboBox();
+    methodCombo->addItems({"Otomatik", "perf", "Dahili örnekleyici"});
+    methodCombo->setToolTip("Otomatik: perf kullanılabiliyorsa perf, yoksa dahili örnekleyici");
+
+    frequencySpin = new QSpinBox();
+    frequencySpin->setRange(10, 20000);
+    frequencySpin->setValue(999);
+    frequencySpin->setSuffix(" Hz");
+    frequencySpin->setToolTip("Örnekleme sıklığı; dahili örnekleyicide çekirdeğin zamanlayıcı "
+                              "çözünürlüğüyle sınırlıdır");
+
+    startButton = new QPushButton("▶ Profil ile Çalıştır");
+    connect(startButton, &QPushButton::clicked, this, [this]() {
+        if (!running)
+            emit runRequested();
+    });
+    stopButton = new QPushButton("■ Durdur");
+    stopButton->setEnabled(false);
+    connect(stopButton, &QPushButton::clicked, this, &ProfilerPanel::stop);
+
+    bar->addWidget(methodCombo);
+    bar->addWidget(frequencySpin);
+    bar->addWidget(startButton);
+    bar->addWidget(stopButton);
+    bar->addStretch();
+
+    statusLabel = new QLabel("Hazır");
+    statusLabel->setStyleSheet("QLabel { color: #cccccc; }");
+    statusLabel->setWordWrap(true);
+    statusLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+
+    flameGraph = new FlameGraph();
+    connect(flameGraph, &FlameGraph::lineActivated, this, &ProfilerPanel::sourceLineActivated);
+
+    QScrollArea *scroll = new QScrollArea();
+    scroll->setWidget(flameGraph);
+    scroll->setWidgetResizable(true);
+    scroll->setStyleSheet("QScrollArea { border: none; background-color: #1e1e1e; }");
+
+    table = new QTableWidget(0, 4);
+    table->setHorizontalHeaderLabels({"Fonksiyon", "Öz %", "Toplam %", "Satır"});
+    table->horizontalHeader()->setSectionResizeMode(0, QHeaderView::Stretch);
+    table->verticalHeader()->setVisible(false);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                         "gridline-color: #454545; border: none; }"
+                         "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                         "border: none; padding: 3px; }");
+    connect(table, &QTableWidget::cellClicked, this, [this](int row) {
+        int line = table->item(row, 3)->text().toInt();
+        if (line > 0)
+            emit sourceLineActivated(line);
+    });
+
+    QSplitter *splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(scroll);
+    splitter->addWidget(table);
+    splitter->setSizes({700, 400});
+
+    layout->addLayout(bar);
+    layout->addWidget(statusLabel);
+    layout->addWidget(splitter);
+}
+
+void ProfilerPanel::showError(const QString &message) {
+    statusLabel->setText(message);
+}
+
+void ProfilerPanel::fail(const QString &message) {
+    running = false;
+    startButton->setEnabled(true);
+    stopButton->setEnabled(false);
+    statusLabel->setText(message);
+}
+
+void ProfilerPanel::stop() {
+    if (!running)
+        return;
+    // Steps still in flight report into a stale generation and are ignored
+    ++generation;
+    if (current)
+        current->kill();
+    fail("Durduruldu");
+}
+
+void ProfilerPanel::start(BuildPipeline *pipeline, const QString &language, const QString &code,
+                          const QStringList &flags, const QString &inputFile, const QString &runDir) {
+    if (running)
+        return;
+#ifndef Q_OS_LINUX
+    showError("Hata: Profil çıkarma yalnızca Linux'ta kullanılabilir");
+    return;
+#endif
+    if (!BuildPipeline::isCompiled(language)) {
+        showError("Hata: Profil çıkarma yalnızca C ve C++ için kullanılabilir!");
+        return;
+    }
+
+    this->pipeline = pipeline;
+    this->inputFile = inputFile;
+    this->runDir = runDir;
+    sourceName = "main" + BuildPipeline::sourceSuffix(language);
+    sourceKey = BuildPipeline::sourceKey(language, code);
+    running = true;
+    startButton->setEnabled(false);
+    stopButton->setEnabled(true);
+    flameGraph->clear();
+    table->setRowCount(0);
+    statusLabel->setText("Hata ayıklama bilgisiyle derleniyor...");
+
+    // Line tables for addr2line, frame pointers for perf's default unwinder
+    QStringList profileFlags = flags;
+    profileFlags << "-g" << "-fno-omit-frame-pointer";
+
+    int run = ++generation;
+    pipeline->build(language, code, profileFlags, [this, run](const RunTarget &built, const QString &log) {
+        if (run != generation)
+            return;
+        if (!built.isValid()) {
+            fail("✗ Derleme hatası:\n" + log);
+            return;
+        }
+        target = built;
+
+        QString choice = methodCombo->currentText();
+        bool havePerf = !QStandardPaths::findExecutable("perf").isEmpty();
+        if (choice == "perf" && !havePerf) {
+            fail("Hata: perf bulunamadı");
+            return;
+        }
+        if (choice == "Dahili örnekleyici" || !havePerf)
+            runSampler();
+        else
+            runPerf();
+    });
+}
+
+QProcess *ProfilerPanel::createProgramProcess() {
+    QProcess *process = new QProcess(this);
+    process->setStandardInputFile(inputFile.isEmpty() ? QProcess::nullDevice() : inputFile);
+    process->setStandardOutputFile(runDir + "/program.out");
+    process->setStandardErrorFile(runDir + "/program.err");
+    current = process;
+    return process;
+}
+
+void ProfilerPanel::runPerf() {
+    method = "perf";
+    statusLabel->setText("perf record ile çalıştırılıyor...");
+    QString data = runDir + "/perf.data";
+    QFile::remove(data);
+
+    QProcess *process = createProgramProcess();
+    int run = generation;
+    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            [this, process, run, data]() {
+        process->deleteLater();
+        if (run != generation)
+            return;
+
+        // perf_event_paranoid or a container can keep perf from recording
+        if (QFileInfo(data).size() == 0) {
+            if (methodCombo->currentText() == "Otomatik") {
+                runSampler();
+                return;
+            }
+            fail("Hata: perf kayıt yapamadı, ayrıntılar: " + runDir + "/program.err");
+            return;
+        }
+
+        statusLabel->setText("perf script ile yığınlar okunuyor...");
+        pipeline->runStep("perf", {"script", "-i", data, "-F", "ip,sym,symoff,dso"},
+                          [this, run](bool ok, const QString &script) {
+            if (run != generation)
+                return;
+            if (!ok) {
+                fail("Hata: perf script başarısız:\n" + script.left(2000));
+                return;
+            }
+            // perf names frames by symbol+offset, nm turns them back into addresses
+            pipeline->runStep("nm", {"-C", "--defined-only", target.program},
+                              [this, run, script](bool ok, const QString &table) {
+                if (run != generation)
+                    return;
+                QHash<QString, quint64> symbols;
+                if (ok) {
+                    static const QRegularExpression symbolRe(R"(^([0-9a-fA-F]+) [tTwW] (.+)$)",
+                                                             QRegularExpression::MultilineOption);
+                    QRegularExpressionMatchIterator it = symbolRe.globalMatch(table);
+                    while (it.hasNext()) {
+                        QRegularExpressionMatch match = it.next();
+                        symbols.insert(match.captured(2), match.captured(1).toULongLong(nullptr, 16));
+                    }
+                }
+                readPerfScript(script, symbols);
+            });
+        });
+    });
+    connect(process, &QProcess::errorOccurred, [this, process, run](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart)
+            return;
+        process->deleteLater();
+        if (run == generation)
+            runSampler();
+    });
+
+    QStringList arguments;
+    arguments << "record" << "-F" << QString::number(frequencySpin->value()) << "-g"
+              << "-o" << data << "--" << target.program << target.arguments;
+    process->start("perf", arguments);
+}
+
+void ProfilerPanel::readPerfScript(const QString &script, const QHash<QString, quint64> &symbols) {
+    //     55d5c1a0d0d6 work(int)+0x66 (/tmp/.../program)
+    static const QRegularExpression frameRe(R"(^\s*([0-9a-f]+)\s+(.*)\s+\(([^()]*)\)\s*$)");
+    QString program = QFileInfo(target.program).canonicalFilePath();
+
+    QVector<QStringList> samples;
+    QStringList frames;
+    const QStringList lines = script.split('\n');
+    for (const QString &line : lines) {
+        QRegularExpressionMatch match = frameRe.match(line);
+        if (!match.hasMatch()) {
+            if (line.trimmed().isEmpty() && !frames.isEmpty()) {
+                samples.append(frames);
+                frames.clear();
+            }
+            continue;
+        }
+
+        QString symbol = match.captured(2).trimmed();
+        QString dso = match.captured(3);
+        int plus = symbol.lastIndexOf("+0x");
+        QString name = plus > 0 ? symbol.left(plus) : symbol;
+        quint64 offset = plus > 0 ? symbol.mid(plus + 3).toULongLong(nullptr, 16) : 0;
+
+        if (QFileInfo(dso).canonicalFilePath() == program && symbols.contains(name))
+            frames << "@" + QString::number(symbols.value(name) + offset, 16);
+        else if (name == "[unknown]")
+            frames << "[" + QFileInfo(dso).fileName() + "]";
+        else
+            frames << name;
+    }
+    if (!frames.isEmpty())
+        samples.append(frames);
+
+    symbolize(samples);
+}
+
+void ProfilerPanel::runSampler() {
+    method = "dahili örnekleyici";
+    statusLabel->setText("Örnekleyici hazırlanıyor...");
+    int run = generation;
+    pipeline->buildPreload("sampler", QByteArray(samplerSource), [this, run](const QString &library,
+                                                                                const QString &log) {
+        if (run != generation)
+            return;
+        if (library.isEmpty()) {
+            fail("✗ Örnekleyici derlenemedi:\n" + log);
+            return;
+        }
+        startSampled(library);
+    });
+}
+
+void ProfilerPanel::startSampled(const QString &library) {
+    statusLabel->setText("Dahili örnekleyiciyle çalıştırılıyor...");
+    QString samplesFile = runDir + "/samples.txt";
+    QFile::remove(samplesFile);
+
+    QProcess *process = createProgramProcess();
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+    QString preload = environment.value("LD_PRELOAD");
+    environment.insert("LD_PRELOAD", preload.isEmpty() ? library : library + ":" + preload);
+    environment.insert("CODEIDE_PROFILE_OUT", samplesFile);
+    environment.insert("CODEIDE_PROFILE_HZ", QString::number(frequencySpin->value()));
+    process->setProcessEnvironment(environment);
+
+    int run = generation;
+    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            [this, process, run, samplesFile]() {
+        process->deleteLater();
+        if (run != generation)
+            return;
+
+        // Samples are written by the library's destructor at a normal exit
+        QFile file(samplesFile);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            fail("Hata: Örnek yok, program normal şekilde sonlanmadı (çökme, _exit veya sinyal)");
+            return;
+        }
+        QVector<QStringList> samples;
+        while (!file.atEnd()) {
+            QString line = QString::fromUtf8(file.readLine()).trimmed();
+            if (!line.isEmpty())
+                samples.append(line.split('\t'));
+        }
+        symbolize(samples);
+    });
+    connect(process, &QProcess::errorOccurred, [this, process, run](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart)
+            return;
+        process->deleteLater();
+        if (run == generation)
+            fail("Hata: " + target.program + " başlatılamadı!");
+    });
+
+    process->start(target.program, target.arguments);
+}
+
+void ProfilerPanel::symbolize(QVector<QStringList> samples) {
+    if (samples.isEmpty()) {
+        fail("Hata: Hiç örnek toplanamadı (program çok kısa sürmüş olabilir)");
+        return;
+    }
+
+    // Callers are sampled at their return address, one byte back is the call
+    QSet<QString> unique;
+    for (QStringList &frames : samples) {
+        for (int i = 1; i < frames.size(); ++i) {
+            if (frames[i].startsWith('@'))
+                frames[i] = "@" + QString::number(frames[i].mid(1).toULongLong(nullptr, 16) - 1, 16);
+        }
+        for (const QString &frame : frames) {
+            if (frame.startsWith('@'))
+                unique.insert(frame);
+        }
+    }
+
+    QList<quint64> addresses;
+    for (const QString &frame : unique)
+        addresses << frame.mid(1).toULongLong(nullptr, 16);
+
+    statusLabel->setText(QString("%1 örnek, %2 adres çözülüyor...").arg(samples.size()).arg(unique.size()));
+    int run = generation;
+    Symbolizer::resolve(pipeline, target.program, addresses,
+                        [this, run, samples](const QHash<quint64, QVector<SourceLocation>> &locations) {
+        if (run == generation)
+            demangle(samples, locations);
+    });
+}
+
+void ProfilerPanel::demangle(const QVector<QStringList> &samples,
+                             const QHash<quint64, QVector<SourceLocation>> &locations) {
+    // The preloaded sampler reports library symbols mangled
+    QSet<QString> mangled;
+    for (const QStringList &frames : samples) {
+        for (const QString &frame : frames) {
+            if (frame.startsWith("_Z"))
+                mangled.insert(frame);
+        }
+    }
+    if (mangled.isEmpty()) {
+        showProfile(samples, locations, QHash<QString, QString>());
+        return;
+    }
+
+    QStringList names(mangled.begin(), mangled.end());
+    int run = generation;
+    pipeline->runStep("c++filt", names, [this, run, samples, locations, names](bool ok, const QString &output) {
+        if (run != generation)
+            return;
+        QHash<QString, QString> demangled;
+        QStringList lines = output.split('\n');
+        if (ok && lines.size() >= names.size()) {
+            for (int i = 0; i < names.size(); ++i)
+                demangled.insert(names[i], lines[i]);
+        }
+        showProfile(samples, locations, demangled);
+    });
+}
+
+void ProfilerPanel::showProfile(const QVector<QStringList> &samples,
+                                const QHash<quint64, QVector<SourceLocation>> &locations,
+                                const QHash<QString, QString> &names) {
+    struct Frame {
+        QString name;
+        int line;
+    };
+    struct FunctionStats {
+        qint64 self = 0;
+        qint64 total = 0;
+        QHash<int, qint64> lines;
+    };
+
+    QString programName = "[" + QFileInfo(target.program).fileName() + "]";
+    QVector<FlameNode> nodes(1);
+    nodes[0].name = "tümü";
+    QHash<QString, int> childIndex;
+    QHash<QString, FunctionStats> functions;
+    LineHeat heat;
+    heat.unit = "örnek";
+
+    for (const QStringList &tokens : samples) {
+        // Expand inlined frames, leaf first
+        QVector<Frame> frames;
+        for (const QString &token : tokens) {
+            if (!token.startsWith('@')) {
+                frames.append(Frame{names.value(token, token), 0});
+                continue;
+            }
+            const QVector<SourceLocation> chain = locations.value(token.mid(1).toULongLong(nullptr, 16));
+            if (chain.isEmpty())
+                frames.append(Frame{programName, 0});
+            for (const SourceLocation &location : chain) {
+                QString name = location.function == "??" ? programName : location.function;
+                frames.append(Frame{name, location.file == sourceName ? location.line : 0});
+            }
+        }
+        if (frames.isEmpty())
+            continue;
+
+        ++nodes[0].total;
+        int node = 0;
+        for (int i = frames.size() - 1; i >= 0; --i) {
+            QString key = QString::number(node) + '\x1f' + frames[i].name;
+            int child = childIndex.value(key, -1);
+            if (child < 0) {
+                FlameNode created;
+                created.name = frames[i].name;
+                created.line = frames[i].line;
+                created.parent = node;
+                nodes.append(created);
+                child = nodes.size() - 1;
+                nodes[node].children.append(child);
+                childIndex.insert(key, child);
+            }
+            ++nodes[child].total;
+            node = child;
+        }
+        ++nodes[node].self;
+
+        for (const Frame &frame : frames) {
+            if (frame.line > 0) {
+                heat.counts[frame.line]++;
+                break;
+            }
+        }
+
+        // Recursive functions count once per sample in their total
+        QSet<QString> seen;
+        functions[frames.first().name].self++;
+        // Leaf samples weigh double (this plus the loop below), so the line
+        // that burns the time wins over call sites
+        if (frames.first().line > 0)
+            functions[frames.first().name].lines[frames.first().line]++;
+        for (const Frame &frame : frames) {
+            if (seen.contains(frame.name))
+                continue;
+            seen.insert(frame.name);
+            FunctionStats &stats = functions[frame.name];
+            stats.total++;
+            if (frame.line > 0)
+                stats.lines[frame.line]++;
+        }
+    }
+
+    // Flame graphs are conventionally ordered by name, not by weight
+    for (FlameNode &node : nodes) {
+        std::sort(node.children.begin(), node.children.end(), [&nodes](int a, int b) {
+            return nodes[a].name < nodes[b].name;
+        });
+    }
+    flameGraph->setNodes(nodes);
+
+    QStringList order = functions.keys();
+    std::sort(order.begin(), order.end(), [&functions](const QString &a, const QString &b) {
+        if (functions[a].self != functions[b].self)
+            return functions[a].self > functions[b].self;
+        return functions[a].total > functions[b].total;
+    });
+
+    double all = qMax<qint64>(1, nodes[0].total);
+    int rows = qMin(order.size(), 200);
+    table->setRowCount(rows);
+    for (int row = 0; row < rows; ++row) {
+        const FunctionStats &stats = functions[order[row]];
+        int line = 0;
+        qint64 best = 0;
+        for (auto it = stats.lines.cbegin(); it != stats.lines.cend(); ++it) {
+            if (it.value() > best) {
+                best = it.value();
+                line = it.key();
+            }
+        }
+        QStringList values;
+        values << order[row]
+               << QString::number(100.0 * stats.self / all, 'f', 1)
+               << QString::number(100.0 * stats.total / all, 'f', 1)
+               << (line > 0 ? QString::number(line) : QString());
+        for (int column = 0; column < values.size(); ++column)
+            table->setItem(row, column, new QTableWidgetItem(values[column]));
+    }
+
+    running = false;
+    startButton->setEnabled(true);
+    stopButton->setEnabled(false);
+    statusLabel->setText(QString("%1 örnek (%2) | program çıktısı: %3")
+                             .arg(nodes[0].total).arg(method).arg(runDir + "/program.out"));
+    emit lineHeatReady(sourceKey, heat);
+}
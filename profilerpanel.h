@@ -0,0 +1,76 @@
+#ifndef PROFILERPANEL_H
+#define PROFILERPANEL_H
+
+#include <QWidget>
+#include <QHash>
+#include <QPointer>
+#include <QVector>
+#include "buildpipeline.h"
+#include "codeeditor.h"
+#include "symbolizer.h"
+
+class FlameGraph;
+class QComboBox;
+class QLabel;
+class QProcess;
+class QPushButton;
+class QSpinBox;
+class QTableWidget;
+
+// Sampling profiler for C/C++ programs: perf record when it is usable,
+// otherwise a SIGPROF sampler preloaded into the program. Stacks are
+// symbolized with addr2line against a -g build and shown as a flame graph
+// and a hot-function table.
+class ProfilerPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit ProfilerPanel(QWidget *parent = nullptr);
+
+    void start(BuildPipeline *pipeline, const QString &language, const QString &code,
+               const QStringList &flags, const QString &inputFile, const QString &runDir);
+    void showError(const QString &message);
+    bool isRunning() const { return running; }
+
+signals:
+    void runRequested();
+    void sourceLineActivated(int line);
+    // Samples per buffer line, attributed to the innermost frame in the buffer
+    void lineHeatReady(const QString &sourceKey, const LineHeat &heat);
+
+private slots:
+    void stop();
+
+private:
+    void runPerf();
+    void runSampler();
+    void startSampled(const QString &library);
+    void readPerfScript(const QString &script, const QHash<QString, quint64> &symbols);
+    void symbolize(QVector<QStringList> samples);
+    void demangle(const QVector<QStringList> &samples, const QHash<quint64, QVector<SourceLocation>> &locations);
+    void showProfile(const QVector<QStringList> &samples, const QHash<quint64, QVector<SourceLocation>> &locations,
+                     const QHash<QString, QString> &names);
+    void fail(const QString &message);
+    QProcess *createProgramProcess();
+
+    QComboBox *methodCombo;
+    QSpinBox *frequencySpin;
+    QPushButton *startButton;
+    QPushButton *stopButton;
+    QLabel *statusLabel;
+    FlameGraph *flameGraph;
+    QTableWidget *table;
+
+    BuildPipeline *pipeline = nullptr;
+    QPointer<QProcess> current;
+    bool running = false;
+    int generation = 0;
+    QString sourceName;
+    QString sourceKey;
+    QString inputFile;
+    QString runDir;
+    QString method;
+    RunTarget target;
+};
+
+#endif // PROFILERPANEL_H
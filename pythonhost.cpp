@@ -0,0 +1,226 @@
+#include "pythonhost.h"
+#include "runstats.h"
+#include <QCoreApplication>
+#include <cstdio>
+#include <cstring>
+
+#ifdef CODEIDE_EMBED_PYTHON
+// Python's headers use "slots" as an identifier, which Qt defines as a macro
+#pragma push_macro("slots")
+#undef slots
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#pragma pop_macro("slots")
+#endif
+
+#if defined(CODEIDE_EMBED_PYTHON) && defined(Q_OS_UNIX)
+#include <cerrno>
+#include <csignal>
+#include <ctime>
+#include <fcntl.h>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef Q_OS_LINUX
+#include <sys/prctl.h>
+#endif
+#endif
+
+static const char *kHostFlag = "--python-host";
+
+#if defined(CODEIDE_EMBED_PYTHON) && defined(Q_OS_UNIX)
+// Evaluated once in the helper. _run executes in the forked child and never
+// returns: the child leaves through os._exit with the script's exit code.
+static const char driverSource[] = R"DRIVER(
+import os, runpy, sys, traceback
+
+def _preload(name):
+    try:
+        __import__(name)
+    except Exception:
+        pass
+
+def _run(path):
+    sys.argv = [path]
+    sys.path.insert(0, os.path.dirname(path))
+    code = 0
+    try:
+        runpy.run_path(path, run_name="__main__")
+    except SystemExit as exit:
+        if exit.code is None:
+            code = 0
+        elif isinstance(exit.code, int):
+            code = exit.code
+        else:
+            print(exit.code, file=sys.stderr)
+            code = 1
+    except BaseException as error:
+        # Start the traceback at the script, not inside runpy
+        frames = error.__traceback__
+        while frames is not None and frames.tb_frame.f_code.co_filename != path:
+            frames = frames.tb_next
+        traceback.print_exception(type(error), error, frames or error.__traceback__)
+        code = 1
+    for stream in (sys.stdout, sys.stderr):
+        try:
+            stream.flush()
+        except Exception:
+            pass
+    os._exit(code)
+)DRIVER";
+
+static void runChild(PyObject *runner, const std::string &script, const std::string &input) {
+#ifdef Q_OS_LINUX
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif
+    PyOS_AfterFork_Child();
+
+    int fd = open(input.empty() ? "/dev/null" : input.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        dup2(fd, STDIN_FILENO);
+        close(fd);
+    }
+
+    PyObject *result = PyObject_CallFunction(runner, "s", script.c_str());
+    Py_XDECREF(result);
+    PyErr_Print();
+    _exit(1);
+}
+#endif
+
+PythonHost::PythonHost(QObject *parent) : ForkServer(parent) {
+}
+
+bool PythonHost::isAvailable() {
+#if defined(CODEIDE_EMBED_PYTHON) && defined(Q_OS_UNIX)
+    return true;
+#else
+    return false;
+#endif
+}
+
+QString PythonHost::version() {
+#ifdef CODEIDE_EMBED_PYTHON
+    return QString::fromLatin1(PY_VERSION);
+#else
+    return QString();
+#endif
+}
+
+bool PythonHost::isHostInvocation(int argc, char *argv[]) {
+    return argc >= 3 && std::strcmp(argv[1], kHostFlag) == 0;
+}
+
+// argv: CodeIDE --python-host <marker> [module...]
+// stdin: one "script\tinput\tstats" line per run
+int PythonHost::exec(int argc, char *argv[]) {
+#if defined(CODEIDE_EMBED_PYTHON) && defined(Q_OS_UNIX)
+    const char *runMarker = argv[2];
+
+    // No Python signal handlers: SIGINT and friends keep their default action
+    Py_InitializeEx(0);
+    PyObject *globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    PyObject *loaded = PyRun_String(driverSource, Py_file_input, globals, globals);
+    if (!loaded) {
+        PyErr_Print();
+        return 1;
+    }
+    Py_DECREF(loaded);
+
+    PyObject *preloader = PyDict_GetItemString(globals, "_preload");
+    for (int i = 3; i < argc; ++i) {
+        PyObject *result = PyObject_CallFunction(preloader, "s", argv[i]);
+        Py_XDECREF(result);
+        PyErr_Clear();
+    }
+    PyObject *runner = PyDict_GetItemString(globals, "_run");
+
+    std::string line;
+    char chunk[4096];
+    while (std::fgets(chunk, sizeof(chunk), stdin)) {
+        line += chunk;
+        if (line.empty() || line.back() != '\n')
+            continue;
+        line.pop_back();
+
+        size_t first = line.find('\t');
+        size_t second = first == std::string::npos ? first : line.find('\t', first + 1);
+        if (second == std::string::npos) {
+            line.clear();
+            continue;
+        }
+        std::string script = line.substr(0, first);
+        std::string input = line.substr(first + 1, second - first - 1);
+        std::string stats = line.substr(second + 1);
+        line.clear();
+
+        std::fflush(stdout);
+        std::fflush(stderr);
+        timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        pid_t pid = fork();
+        if (pid == 0)
+            runChild(runner, script, input);
+
+        int status = 0;
+        rusage usage;
+        std::memset(&usage, 0, sizeof(usage));
+        if (pid < 0) {
+            std::perror("fork");
+            status = 127 << 8;
+        } else {
+            while (wait4(pid, &status, 0, &usage) < 0 && errno == EINTR) {}
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        double wallMs = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+        MeasuredRun::writeStats(stats.c_str(), status, wallMs, usage);
+
+        int exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+        std::fprintf(stdout, "%s%d\n", runMarker, exitCode);
+        std::fflush(stdout);
+        std::fprintf(stderr, "%s%d\n", runMarker, exitCode);
+        std::fflush(stderr);
+    }
+
+    Py_DECREF(globals);
+    Py_FinalizeEx();
+    return 0;
+#else
+    Q_UNUSED(argc);
+    Q_UNUSED(argv);
+    std::fprintf(stderr, "CodeIDE was built without CODEIDE_EMBED_PYTHON\n");
+    return 1;
+#endif
+}
+
+void PythonHost::setPreloadModules(const QStringList &modules) {
+    if (modules == preload)
+        return;
+    preload = modules;
+    // Picked up by the next helper, the running one keeps what it imported
+    if (isStarted() && !isRunning())
+        shutdown();
+}
+
+void PythonHost::warmUp() {
+    if (!isAvailable())
+        return;
+
+    QStringList arguments;
+    arguments << kHostFlag << QString::fromLatin1(marker()) << preload;
+    launch(QCoreApplication::applicationFilePath(), arguments);
+}
+
+void PythonHost::run(const QString &script, const QString &inputFile, const QString &statsFile) {
+    if (!isAvailable()) {
+        emit failed("Hata: Bu derleme gömülü Python desteği içermiyor!");
+        return;
+    }
+    if (isRunning())
+        shutdown();
+    warmUp();
+    send(script, inputFile, statsFile);
+}
@@ -0,0 +1,33 @@
+#ifndef PYTHONHOST_H
+#define PYTHONHOST_H
+
+#include "forkserver.h"
+
+// Warm CPython for short scripts. When built with CODEIDE_EMBED_PYTHON the
+// IDE binary doubles as a helper ("CodeIDE --python-host") that embeds the
+// interpreter, imports the heavy modules once and then forks a child per
+// run. Every script gets a fresh __main__ and its own process, but none of
+// the interpreter start-up or numpy import cost.
+class PythonHost : public ForkServer {
+    Q_OBJECT
+
+public:
+    explicit PythonHost(QObject *parent = nullptr);
+
+    static bool isAvailable();
+    static QString version();
+    static bool isHostInvocation(int argc, char *argv[]);
+    static int exec(int argc, char *argv[]);
+
+    void setPreloadModules(const QStringList &modules);
+    QStringList preloadModules() const { return preload; }
+    // Starts the helper ahead of the first run
+    void warmUp();
+    // Stats are written by the helper in the MeasuredRun format
+    void run(const QString &script, const QString &inputFile, const QString &statsFile);
+
+private:
+    QStringList preload;
+};
+
+#endif // PYTHONHOST_H
@@ -0,0 +1,375 @@
+#include "pythonprofilerpanel.h"
+#include "buildpipeline.h"
+#include <QComboBox>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QJsonDocument>
+#include <QLabel>
+#include <QProcess>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QVBoxLayout>
+
+// Runs the script under cProfile or a line tracer and dumps the result as
+// JSON: {"interpreter", "implementation", "wall", "status",
+// "functions": [{"file", "line", "name", "calls", "primitive", "self", "total"}],
+// "lines": {"<line>": [hits, nanoseconds]}}. Plain stdlib, so it works the
+// same under every CPython version and PyPy.
+static const char runnerSource[] = R"RUNNER(
+import json
+import os
+import sys
+import threading
+import time
+
+
+def profile_functions(script, code, namespace):
+    import cProfile
+    import pstats
+
+    profiler = cProfile.Profile()
+    try:
+        profiler.runctx(code, namespace, namespace)
+    finally:
+        functions = []
+        for (path, line, name), (primitive, calls, own, total, _) in pstats.Stats(profiler).stats.items():
+            functions.append({"file": path, "line": line, "name": name, "calls": calls,
+                              "primitive": primitive, "self": own, "total": total})
+        result["functions"] = functions
+
+
+def profile_lines(script, code, namespace):
+    # Inclusive time per line, like line_profiler: a line is charged until
+    # its frame reaches the next line, callees included
+    clock = time.perf_counter_ns
+    lines = {}
+    current = {}
+
+    def local(frame, event, arg):
+        now = clock()
+        previous = current.get(frame)
+        if previous is not None:
+            lines.setdefault(previous[0], [0, 0])[1] += now - previous[1]
+        if event == "line":
+            lines.setdefault(frame.f_lineno, [0, 0])[0] += 1
+            current[frame] = (frame.f_lineno, clock())
+        elif event == "return":
+            current.pop(frame, None)
+        return local
+
+    def tracer(frame, event, arg):
+        # Other files are not traced line by line at all
+        if frame.f_code.co_filename != script:
+            return None
+        current[frame] = (frame.f_lineno, clock())
+        return local
+
+    threading.settrace(tracer)
+    sys.settrace(tracer)
+    try:
+        exec(code, namespace)
+    finally:
+        sys.settrace(None)
+        threading.settrace(None)
+        result["lines"] = {str(line): value for line, value in lines.items()}
+
+
+result = {"interpreter": sys.version.split()[0],
+          "implementation": sys.implementation.name}
+
+
+def main():
+    script, output, mode = os.path.abspath(sys.argv[1]), sys.argv[2], sys.argv[3]
+    sys.argv = [script]
+    sys.path.insert(0, os.path.dirname(script))
+    with open(script, "rb") as source:
+        code = compile(source.read(), script, "exec")
+    namespace = {"__name__": "__main__", "__file__": script, "__builtins__": __builtins__}
+
+    start = time.perf_counter()
+    status = 0
+    try:
+        if mode == "lines":
+            profile_lines(script, code, namespace)
+        else:
+            profile_functions(script, code, namespace)
+    except SystemExit as exit:
+        status = exit.code if isinstance(exit.code, int) else 0
+    except BaseException:
+        import traceback
+        traceback.print_exc()
+        status = 1
+    result["wall"] = time.perf_counter() - start
+    result["status"] = status
+    with open(output, "w") as file:
+        json.dump(result, file)
+    sys.stdout.flush()
+    sys.stderr.flush()
+    os._exit(status)
+
+
+main()
+)RUNNER";
+
+PythonProfilerPanel::PythonProfilerPanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+
+    modeCombo = new QComboBox();
+    modeCombo->addItems({"Fonksiyonlar (cProfile)", "Satırlar"});
+    modeCombo->setToolTip("Satır modu her satırı izler; süreler callee'leri de içerir ve program "
+                          "belirgin şekilde yavaşlar");
+
+    startButton = new QPushButton("▶ Profil ile Çalıştır");
+    connect(startButton, &QPushButton::clicked, this, [this]() {
+        if (!running)
+            emit runRequested();
+    });
+    stopButton = new QPushButton("■ Durdur");
+    stopButton->setEnabled(false);
+    connect(stopButton, &QPushButton::clicked, this, &PythonProfilerPanel::stop);
+
+    statusLabel = new QLabel("Hazır");
+    statusLabel->setStyleSheet("QLabel { color: #cccccc; }");
+    statusLabel->setWordWrap(true);
+
+    bar->addWidget(modeCombo);
+    bar->addWidget(startButton);
+    bar->addWidget(stopButton);
+    bar->addWidget(statusLabel, 1);
+
+    historyLabel = new QLabel();
+    historyLabel->setStyleSheet("QLabel { color: #9cdcfe; }");
+    historyLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+
+    table = new QTableWidget(0, 0);
+    table->verticalHeader()->setVisible(false);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                         "gridline-color: #454545; border: none; }"
+                         "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                         "border: none; padding: 3px; }");
+    connect(table, &QTableWidget::cellClicked, this, [this](int row) {
+        // Line column holds 0 for code outside the buffer
+        int line = table->item(row, 0)->data(Qt::UserRole).toInt();
+        if (line > 0)
+            emit sourceLineActivated(line);
+    });
+
+    layout->addLayout(bar);
+    layout->addWidget(historyLabel);
+    layout->addWidget(table);
+}
+
+void PythonProfilerPanel::showError(const QString &message) {
+    statusLabel->setText(message);
+}
+
+void PythonProfilerPanel::fail(const QString &message) {
+    running = false;
+    startButton->setEnabled(true);
+    stopButton->setEnabled(false);
+    statusLabel->setText(message);
+}
+
+void PythonProfilerPanel::stop() {
+    if (!running)
+        return;
+    ++generation;
+    if (process)
+        process->kill();
+    fail("Durduruldu");
+}
+
+void PythonProfilerPanel::start(BuildPipeline *pipeline, const QString &code, const QString &inputFile,
+                                const QString &runDir) {
+    if (running)
+        return;
+
+    QByteArray runner(runnerSource);
+    QString key = QString::fromLatin1(QCryptographicHash::hash(runner, QCryptographicHash::Sha1).toHex().left(16));
+    QString dir = QDir(pipeline->rootDir()).filePath("pyprofile-" + key);
+    QString runnerFile = dir + "/runner.py";
+    if (!QFileInfo::exists(runnerFile)) {
+        QDir().mkpath(dir);
+        QFile file(runnerFile);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            showError("Hata: Dosya oluşturulamadı!");
+            return;
+        }
+        file.write(runner);
+    }
+
+    QString script = runDir + "/main.py";
+    QFile file(script);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        showError("Hata: Dosya oluşturulamadı!");
+        return;
+    }
+    file.write(code.toUtf8());
+    file.close();
+
+    bool lines = modeCombo->currentIndex() == 1;
+    QString interpreter = pipeline->interpreter("Python");
+    sourceKey = BuildPipeline::sourceKey("Python", code);
+    // Timings are only comparable for the same source and mode
+    QString newHistoryKey = sourceKey + (lines ? "/lines" : "/functions");
+    if (newHistoryKey != historyKey) {
+        historyKey = newHistoryKey;
+        history.clear();
+        historyLabel->clear();
+    }
+
+    running = true;
+    startButton->setEnabled(false);
+    stopButton->setEnabled(true);
+    statusLabel->setText(interpreter + " ile profil çıkarılıyor...");
+
+    QString output = runDir + "/profile.json";
+    QProcess *program = new QProcess(this);
+    program->setStandardInputFile(inputFile.isEmpty() ? QProcess::nullDevice() : inputFile);
+    program->setStandardOutputFile(runDir + "/program.out");
+    program->setStandardErrorFile(runDir + "/program.err");
+    program->setWorkingDirectory(runDir);
+    process = program;
+
+    int current = ++generation;
+    connect(program, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            [this, program, current, output, script, interpreter, lines, runDir]() {
+        program->deleteLater();
+        if (current != generation)
+            return;
+
+        QFile file(output);
+        if (!file.open(QIODevice::ReadOnly)) {
+            fail("Hata: Profil yazılamadı, ayrıntılar: " + runDir + "/program.err");
+            return;
+        }
+        QJsonObject result = QJsonDocument::fromJson(file.readAll()).object();
+        if (lines)
+            showLines(result.value("lines").toObject());
+        else
+            showFunctions(result.value("functions").toArray(), script);
+
+        double wall = result.value("wall").toDouble();
+        QString name = QString("%1 (%2 %3)").arg(interpreter, result.value("implementation").toString(),
+                                                 result.value("interpreter").toString());
+        history.insert(name, wall);
+        QStringList entries;
+        for (auto it = history.cbegin(); it != history.cend(); ++it)
+            entries << QString("%1: %2 s").arg(it.key()).arg(it.value(), 0, 'f', 3);
+        historyLabel->setText("Karşılaştırma: " + entries.join(" | "));
+
+        running = false;
+        startButton->setEnabled(true);
+        stopButton->setEnabled(false);
+        QString status = QString("%1 ile %2 s").arg(name).arg(wall, 0, 'f', 3);
+        if (result.value("status").toInt() != 0)
+            status += QString(" | çıkış kodu %1, ayrıntılar: %2").arg(result.value("status").toInt())
+                          .arg(runDir + "/program.err");
+        statusLabel->setText(status);
+    });
+    connect(program, &QProcess::errorOccurred, [this, program, current, interpreter](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart)
+            return;
+        program->deleteLater();
+        if (current == generation)
+            fail("Hata: " + interpreter + " başlatılamadı!");
+    });
+
+    program->start(interpreter, {runnerFile, script, output, lines ? "lines" : "functions"});
+}
+
+void PythonProfilerPanel::showFunctions(const QJsonArray &functions, const QString &script) {
+    table->setSortingEnabled(false);
+    table->clear();
+    table->setColumnCount(6);
+    table->setHorizontalHeaderLabels({"Satır", "Fonksiyon", "Çağrı", "Öz (ms)", "Toplam (ms)", "Çağrı başı (ms)"});
+    table->horizontalHeader()->setSectionResizeMode(1, QHeaderView::Stretch);
+    table->setRowCount(functions.size());
+
+    QString scriptPath = QFileInfo(script).absoluteFilePath();
+    for (int row = 0; row < functions.size(); ++row) {
+        QJsonObject function = functions[row].toObject();
+        QString file = function.value("file").toString();
+        bool inBuffer = QFileInfo(file).absoluteFilePath() == scriptPath;
+        int line = function.value("line").toInt();
+        int calls = function.value("calls").toInt();
+        double self = function.value("self").toDouble() * 1000.0;
+        double total = function.value("total").toDouble() * 1000.0;
+
+        // Built-ins come as file "~", line 0
+        QString name = function.value("name").toString();
+        if (!inBuffer && file != "~")
+            name += "  (" + QFileInfo(file).fileName() + ":" + QString::number(line) + ")";
+
+        QTableWidgetItem *lineItem = new QTableWidgetItem(inBuffer ? QString::number(line) : QString());
+        lineItem->setData(Qt::UserRole, inBuffer ? line : 0);
+        QTableWidgetItem *callsItem = new QTableWidgetItem();
+        callsItem->setData(Qt::DisplayRole, calls);
+        QTableWidgetItem *selfItem = new QTableWidgetItem();
+        selfItem->setData(Qt::DisplayRole, qRound64(self * 1000.0) / 1000.0);
+        QTableWidgetItem *totalItem = new QTableWidgetItem();
+        totalItem->setData(Qt::DisplayRole, qRound64(total * 1000.0) / 1000.0);
+        QTableWidgetItem *perCallItem = new QTableWidgetItem();
+        perCallItem->setData(Qt::DisplayRole, calls > 0 ? qRound64(total / calls * 1000.0) / 1000.0 : 0.0);
+
+        table->setItem(row, 0, lineItem);
+        table->setItem(row, 1, new QTableWidgetItem(name));
+        table->setItem(row, 2, callsItem);
+        table->setItem(row, 3, selfItem);
+        table->setItem(row, 4, totalItem);
+        table->setItem(row, 5, perCallItem);
+    }
+    table->setSortingEnabled(true);
+    table->sortItems(3, Qt::DescendingOrder);
+}
+
+void PythonProfilerPanel::showLines(const QJsonObject &lines) {
+    table->setSortingEnabled(false);
+    table->clear();
+    table->setColumnCount(4);
+    table->setHorizontalHeaderLabels({"Satır", "İsabet", "Süre (ms)", "Çalıştırma başı (µs)"});
+    table->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    table->setRowCount(0);
+
+    LineHeat heat;
+    heat.unit = "µs";
+    for (auto it = lines.constBegin(); it != lines.constEnd(); ++it) {
+        int line = it.key().toInt();
+        QJsonArray value = it.value().toArray();
+        qint64 hits = qint64(value.at(0).toDouble());
+        double nanoseconds = value.at(1).toDouble();
+        // Line 0 is the module frame before its first line runs
+        if (line <= 0)
+            continue;
+        heat.counts.insert(line, qint64(nanoseconds / 1000.0));
+
+        int row = table->rowCount();
+        table->insertRow(row);
+        QTableWidgetItem *lineItem = new QTableWidgetItem();
+        lineItem->setData(Qt::DisplayRole, line);
+        lineItem->setData(Qt::UserRole, line);
+        QTableWidgetItem *hitsItem = new QTableWidgetItem();
+        hitsItem->setData(Qt::DisplayRole, hits);
+        QTableWidgetItem *timeItem = new QTableWidgetItem();
+        timeItem->setData(Qt::DisplayRole, qRound64(nanoseconds / 1000.0) / 1000.0);
+        QTableWidgetItem *perHitItem = new QTableWidgetItem();
+        perHitItem->setData(Qt::DisplayRole, hits > 0 ? qRound64(nanoseconds / hits) / 1000.0 : 0.0);
+        table->setItem(row, 0, lineItem);
+        table->setItem(row, 1, hitsItem);
+        table->setItem(row, 2, timeItem);
+        table->setItem(row, 3, perHitItem);
+    }
+    table->setSortingEnabled(true);
+    table->sortItems(2, Qt::DescendingOrder);
+
+    emit lineHeatReady(sourceKey, heat);
+}
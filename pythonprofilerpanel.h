@@ -0,0 +1,59 @@
+#ifndef PYTHONPROFILERPANEL_H
+#define PYTHONPROFILERPANEL_H
+
+#include <QWidget>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QMap>
+#include <QPointer>
+#include "codeeditor.h"
+
+class BuildPipeline;
+class QComboBox;
+class QLabel;
+class QProcess;
+class QPushButton;
+class QTableWidget;
+
+// Profiled Python runs with the selected interpreter: cProfile for a
+// function table, or a line tracer whose per-line times go to the gutter.
+// Wall times per interpreter are kept for the current source to compare.
+class PythonProfilerPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit PythonProfilerPanel(QWidget *parent = nullptr);
+
+    void start(BuildPipeline *pipeline, const QString &code, const QString &inputFile, const QString &runDir);
+    void showError(const QString &message);
+    bool isRunning() const { return running; }
+
+signals:
+    void runRequested();
+    void sourceLineActivated(int line);
+    void lineHeatReady(const QString &sourceKey, const LineHeat &heat);
+
+private slots:
+    void stop();
+
+private:
+    void showFunctions(const QJsonArray &functions, const QString &script);
+    void showLines(const QJsonObject &lines);
+    void fail(const QString &message);
+
+    QComboBox *modeCombo;
+    QPushButton *startButton;
+    QPushButton *stopButton;
+    QLabel *statusLabel;
+    QLabel *historyLabel;
+    QTableWidget *table;
+
+    QPointer<QProcess> process;
+    bool running = false;
+    int generation = 0;
+    QString sourceKey;
+    QString historyKey;
+    QMap<QString, double> history;
+};
+
+#endif // PYTHONPROFILERPANEL_H
@@ -0,0 +1,251 @@
+#include "resourcemonitor.h"
+#include "plotwidget.h"
+#include <QDir>
+#include <QFile>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QSpinBox>
+#include <QSplitter>
+#include <QTableWidget>
+#include <QVBoxLayout>
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+
+// Indexes into statFields(), i.e. proc(5) field number minus 3
+static const int statState = 0;
+static const int statParent = 1;
+static const int statMinorFaults = 7;
+static const int statMajorFaults = 9;
+static const int statUserTicks = 11;
+static const int statSystemTicks = 12;
+
+ResourceMonitor::ResourceMonitor(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+    QLabel *intervalLabel = new QLabel("Örnekleme aralığı:");
+    intervalLabel->setStyleSheet("QLabel { color: #cccccc; }");
+    intervalSpin = new QSpinBox();
+    intervalSpin->setRange(20, 5000);
+    intervalSpin->setValue(100);
+    intervalSpin->setSuffix(" ms");
+    connect(intervalSpin, QOverload<int>::of(&QSpinBox::valueChanged), &sampleTimer,
+            QOverload<int>::of(&QTimer::setInterval));
+
+    summaryLabel = new QLabel("Çalışan program yok");
+    summaryLabel->setStyleSheet("QLabel { color: #cccccc; }");
+
+    bar->addWidget(intervalLabel);
+    bar->addWidget(intervalSpin);
+    bar->addSpacing(20);
+    bar->addWidget(summaryLabel, 1);
+
+    rssPlot = new PlotWidget();
+    rssPlot->setAxisLabels("Zaman (sn)", "RSS (MB)");
+
+    threadTable = new QTableWidget(0, 6);
+    threadTable->setHorizontalHeaderLabels({"TID", "Ad", "Durum", "CPU %", "Gönüllü geçiş",
+                                            "Zorunlu geçiş"});
+    threadTable->horizontalHeader()->setStretchLastSection(true);
+    threadTable->verticalHeader()->setVisible(false);
+    threadTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    threadTable->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                               "gridline-color: #454545; border: none; }"
+                               "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                               "border: none; padding: 3px; }");
+
+    QSplitter *splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(rssPlot);
+    splitter->addWidget(threadTable);
+    splitter->setSizes({600, 500});
+
+    layout->addLayout(bar);
+    layout->addWidget(splitter);
+
+    sampleTimer.setInterval(intervalSpin->value());
+    connect(&sampleTimer, &QTimer::timeout, this, &ResourceMonitor::sample);
+}
+
+void ResourceMonitor::attach(qint64 pid) {
+    wrapperPid = pid;
+    targetPid = 0;
+    peakRssKb = 0;
+    peakThreads = 0;
+    lastSampleMs = 0;
+    cpuPercent = 0;
+    lastThreadTicks.clear();
+    threadTable->setRowCount(0);
+
+    rssPlot->clear();
+    rssSeries = rssPlot->addSeries("RSS", QColor(86, 156, 214));
+
+#ifdef Q_OS_LINUX
+    summaryLabel->setText(QString("İzleniyor (pid %1)").arg(pid));
+    clock.start();
+    sampleTimer.start();
+    sample();
+#else
+    summaryLabel->setText("Kaynak izleyici yalnızca Linux'ta kullanılabilir");
+#endif
+}
+
+void ResourceMonitor::detach(const RunStats &stats) {
+    if (wrapperPid == 0)
+        return;
+    sampleTimer.stop();
+    wrapperPid = 0;
+
+    if (!stats.valid) {
+        summaryLabel->setText("Program bitti");
+        return;
+    }
+
+    // Final numbers come from wait4(), which also covers the time after the last sample
+    summaryLabel->setText(QString("Bitti — süre %1 ms | CPU %2 ms (kullanıcı) + %3 ms (sistem) | "
+                                  "en yüksek RSS %4 MB | en fazla iş parçacığı %5 | "
+                                  "sayfa hatası %6 küçük / %7 büyük | geçiş %8 gönüllü / %9 zorunlu")
+                              .arg(stats.wallMs, 0, 'f', 1)
+                              .arg(stats.userMs, 0, 'f', 1)
+                              .arg(stats.sysMs, 0, 'f', 1)
+                              .arg(stats.maxRssKb / 1024.0, 0, 'f', 1)
+                              .arg(peakThreads)
+                              .arg(stats.minorFaults)
+                              .arg(stats.majorFaults)
+                              .arg(stats.voluntarySwitches)
+                              .arg(stats.involuntarySwitches));
+}
+
+QString ResourceMonitor::readProcFile(const QString &path) {
+    // /proc files report size 0, so read until EOF
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return QString();
+    return QString::fromLatin1(file.readAll());
+}
+
+QStringList ResourceMonitor::statFields(const QString &stat) {
+    // The command name may contain spaces and parentheses; fields start after the last ')'
+    int end = stat.lastIndexOf(')');
+    if (end < 0)
+        return QStringList();
+    return stat.mid(end + 2).split(' ');
+}
+
+qint64 ResourceMonitor::statusValue(const QString &status, const QString &key) {
+    // Anchor on the line start so "voluntary_..." does not match "nonvoluntary_..."
+    QString label = "\n" + key + ":";
+    int start = status.indexOf(label);
+    if (start < 0)
+        return 0;
+    start += label.size();
+    int end = status.indexOf('\n', start);
+    QString value = status.mid(start, end < 0 ? -1 : end - start);
+    return value.simplified().section(' ', 0, 0).toLongLong();
+}
+
+qint64 ResourceMonitor::resolveTarget(qint64 pid) const {
+    // The program runs as the only child of the measuring wrapper
+    QString children = readProcFile(QString("/proc/%1/task/%1/children").arg(pid)).simplified();
+    if (!children.isEmpty())
+        return children.section(' ', 0, 0).toLongLong();
+
+    // Kernels without CONFIG_PROC_CHILDREN: look for the parent pid instead
+    const QStringList entries = QDir("/proc").entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+    for (const QString &entry : entries) {
+        bool ok;
+        qint64 candidate = entry.toLongLong(&ok);
+        if (!ok)
+            continue;
+        QStringList fields = statFields(readProcFile("/proc/" + entry + "/stat"));
+        if (fields.value(statParent).toLongLong() == pid)
+            return candidate;
+    }
+    return 0;
+}
+
+void ResourceMonitor::sample() {
+#ifdef Q_OS_LINUX
+    if (targetPid == 0) {
+        targetPid = resolveTarget(wrapperPid);
+        if (targetPid == 0)
+            return;
+    }
+
+    QString base = QString("/proc/%1").arg(targetPid);
+    QString status = readProcFile(base + "/status");
+    if (status.isEmpty())
+        return;
+
+    double now = clock.nsecsElapsed() / 1e6;
+    double seconds = (now - lastSampleMs) / 1000.0;
+    lastSampleMs = now;
+
+    qint64 rssKb = statusValue(status, "VmRSS");
+    peakRssKb = qMax(peakRssKb, statusValue(status, "VmHWM"));
+    int threads = int(statusValue(status, "Threads"));
+    peakThreads = qMax(peakThreads, threads);
+    rssPlot->appendPoint(rssSeries, QPointF(now / 1000.0, rssKb / 1024.0));
+
+    updateThreads(base, seconds);
+
+    QStringList stat = statFields(readProcFile(base + "/stat"));
+    summaryLabel->setText(QString("pid %1 | RSS %2 MB (en yüksek %3 MB) | CPU %4% | %5 iş parçacığı | "
+                                  "sayfa hatası %6 / %7 | geçiş %8 / %9")
+                              .arg(targetPid)
+                              .arg(rssKb / 1024.0, 0, 'f', 1)
+                              .arg(peakRssKb / 1024.0, 0, 'f', 1)
+                              .arg(cpuPercent, 0, 'f', 0)
+                              .arg(threads)
+                              .arg(stat.value(statMinorFaults))
+                              .arg(stat.value(statMajorFaults))
+                              .arg(statusValue(status, "voluntary_ctxt_switches"))
+                              .arg(statusValue(status, "nonvoluntary_ctxt_switches")));
+#endif
+}
+
+void ResourceMonitor::updateThreads(const QString &base, double seconds) {
+#ifdef Q_OS_LINUX
+    static const double ticksPerSecond = double(sysconf(_SC_CLK_TCK));
+
+    const QStringList tids = QDir(base + "/task").entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+    threadTable->setRowCount(tids.size());
+    cpuPercent = 0;
+
+    for (int row = 0; row < tids.size(); ++row) {
+        const QString &tid = tids[row];
+        QString taskDir = base + "/task/" + tid;
+        QStringList stat = statFields(readProcFile(taskDir + "/stat"));
+        QString status = readProcFile(taskDir + "/status");
+
+        qint64 ticks = stat.value(statUserTicks).toLongLong() + stat.value(statSystemTicks).toLongLong();
+        qint64 previous = lastThreadTicks.value(tid, ticks);
+        lastThreadTicks[tid] = ticks;
+        double cpu = seconds > 0 ? (ticks - previous) / ticksPerSecond / seconds * 100.0 : 0;
+        cpuPercent += cpu;
+
+        QStringList values;
+        values << tid
+               << readProcFile(taskDir + "/comm").trimmed()
+               << stat.value(statState)
+               << QString::number(cpu, 'f', 0)
+               << QString::number(statusValue(status, "voluntary_ctxt_switches"))
+               << QString::number(statusValue(status, "nonvoluntary_ctxt_switches"));
+
+        for (int column = 0; column < values.size(); ++column) {
+            QTableWidgetItem *item = threadTable->item(row, column);
+            if (!item) {
+                item = new QTableWidgetItem();
+                threadTable->setItem(row, column, item);
+            }
+            item->setText(values[column]);
+        }
+    }
+#else
+    Q_UNUSED(base);
+    Q_UNUSED(seconds);
+#endif
+}
@@ -0,0 +1,53 @@
+#ifndef RESOURCEMONITOR_H
+#define RESOURCEMONITOR_H
+
+#include <QWidget>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QTimer>
+#include "runstats.h"
+
+class PlotWidget;
+class QTableWidget;
+class QLabel;
+class QSpinBox;
+
+// Samples /proc for a running program: RSS over time, per-thread CPU,
+// context switches and page faults. Linux only.
+class ResourceMonitor : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit ResourceMonitor(QWidget *parent = nullptr);
+
+    void attach(qint64 wrapperPid);
+    void detach(const RunStats &stats);
+
+private slots:
+    void sample();
+
+private:
+    qint64 resolveTarget(qint64 pid) const;
+    void updateThreads(const QString &base, double seconds);
+    static QString readProcFile(const QString &path);
+    static QStringList statFields(const QString &stat);
+    static qint64 statusValue(const QString &status, const QString &key);
+
+    QSpinBox *intervalSpin;
+    PlotWidget *rssPlot;
+    int rssSeries = -1;
+    QTableWidget *threadTable;
+    QLabel *summaryLabel;
+
+    QTimer sampleTimer;
+    QElapsedTimer clock;
+    qint64 wrapperPid = 0;
+    qint64 targetPid = 0;
+    qint64 peakRssKb = 0;
+    int peakThreads = 0;
+    double lastSampleMs = 0;
+    double cpuPercent = 0;
+    QHash<QString, qint64> lastThreadTicks;
+};
+
+#endif // RESOURCEMONITOR_H
@@ -0,0 +1,160 @@
+#include "runstats.h"
+#include <QCoreApplication>
+#include <QFile>
+#include <QTextStream>
+#include <cstring>
+
+#ifdef Q_OS_UNIX
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <ctime>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef Q_OS_LINUX
+#include <sys/prctl.h>
+#endif
+#endif
+
+static const char *kMeasureFlag = "--measure";
+
+RunStats RunStats::load(const QString &path) {
+    RunStats stats;
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return stats;
+
+    QTextStream in(&file);
+    while (!in.atEnd()) {
+        QString line = in.readLine();
+        int eq = line.indexOf('=');
+        if (eq < 0) continue;
+
+        QString key = line.left(eq);
+        QString value = line.mid(eq + 1);
+        if (key == "exit") stats.exitCode = value.toInt();
+        else if (key == "signal") stats.signal = value.toInt();
+        else if (key == "wall_ms") stats.wallMs = value.toDouble();
+        else if (key == "user_ms") stats.userMs = value.toDouble();
+        else if (key == "sys_ms") stats.sysMs = value.toDouble();
+        else if (key == "max_rss_kb") stats.maxRssKb = value.toLongLong();
+        else if (key == "minor_faults") stats.minorFaults = value.toLongLong();
+        else if (key == "major_faults") stats.majorFaults = value.toLongLong();
+        else if (key == "voluntary_switches") stats.voluntarySwitches = value.toLongLong();
+        else if (key == "involuntary_switches") stats.involuntarySwitches = value.toLongLong();
+    }
+    stats.valid = true;
+    return stats;
+}
+
+QString RunStats::summary() const {
+    if (!valid)
+        return "Ölçüm yok";
+
+    QString result = QString("Süre: %1 ms (kullanıcı %2 ms, sistem %3 ms) | Bellek: %4 KB")
+                         .arg(wallMs, 0, 'f', 2)
+                         .arg(userMs, 0, 'f', 2)
+                         .arg(sysMs, 0, 'f', 2)
+                         .arg(maxRssKb);
+    if (signal != 0)
+        result += QString(" | Sinyal: %1").arg(signal);
+    else
+        result += QString(" | Çıkış kodu: %1").arg(exitCode);
+    return result;
+}
+
+void MeasuredRun::wrap(QString &program, QStringList &arguments, const QString &statsFile) {
+#ifdef Q_OS_UNIX
+    arguments.prepend(program);
+    arguments.prepend(statsFile);
+    arguments.prepend(kMeasureFlag);
+    program = QCoreApplication::applicationFilePath();
+#else
+    Q_UNUSED(program);
+    Q_UNUSED(arguments);
+    Q_UNUSED(statsFile);
+#endif
+}
+
+bool MeasuredRun::isWrapperInvocation(int argc, char *argv[]) {
+    return argc >= 4 && std::strcmp(argv[1], kMeasureFlag) == 0;
+}
+
+#ifdef Q_OS_UNIX
+static double elapsedMs(const timespec &start, const timespec &end) {
+    return (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+static double timevalMs(const timeval &tv) {
+    return tv.tv_sec * 1e3 + tv.tv_usec / 1e3;
+}
+#endif
+
+int MeasuredRun::exec(int argc, char *argv[]) {
+#ifdef Q_OS_UNIX
+    Q_UNUSED(argc);
+    const char *statsFile = argv[2];
+    char **childArgv = argv + 3;
+
+    timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        std::perror("fork");
+        return 127;
+    }
+    if (pid == 0) {
+#ifdef Q_OS_LINUX
+        // Do not outlive the wrapper when the IDE kills it
+        prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif
+        execvp(childArgv[0], childArgv);
+        std::fprintf(stderr, "%s: %s\n", childArgv[0], std::strerror(errno));
+        _exit(127);
+    }
+
+    int status = 0;
+    rusage usage;
+    std::memset(&usage, 0, sizeof(usage));
+    while (wait4(pid, &status, 0, &usage) < 0 && errno == EINTR) {}
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    writeStats(statsFile, status, elapsedMs(start, end), usage);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+#else
+    Q_UNUSED(argc);
+    Q_UNUSED(argv);
+    return 1;
+#endif
+}
+
+void MeasuredRun::writeStats(const char *statsFile, int status, double wallMs, const struct rusage &usage) {
+#ifdef Q_OS_UNIX
+    FILE *out = std::fopen(statsFile, "w");
+    if (!out)
+        return;
+    std::fprintf(out, "exit=%d\n", WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+    std::fprintf(out, "signal=%d\n", WIFSIGNALED(status) ? WTERMSIG(status) : 0);
+    std::fprintf(out, "wall_ms=%.3f\n", wallMs);
+    std::fprintf(out, "user_ms=%.3f\n", timevalMs(usage.ru_utime));
+    std::fprintf(out, "sys_ms=%.3f\n", timevalMs(usage.ru_stime));
+#ifdef Q_OS_MACOS
+    // ru_maxrss is in bytes on macOS, kilobytes everywhere else
+    std::fprintf(out, "max_rss_kb=%ld\n", usage.ru_maxrss / 1024);
+#else
+    std::fprintf(out, "max_rss_kb=%ld\n", usage.ru_maxrss);
+#endif
+    std::fprintf(out, "minor_faults=%ld\n", usage.ru_minflt);
+    std::fprintf(out, "major_faults=%ld\n", usage.ru_majflt);
+    std::fprintf(out, "voluntary_switches=%ld\n", usage.ru_nvcsw);
+    std::fprintf(out, "involuntary_switches=%ld\n", usage.ru_nivcsw);
+    std::fclose(out);
+#else
+    Q_UNUSED(statsFile);
+    Q_UNUSED(status);
+    Q_UNUSED(wallMs);
+    Q_UNUSED(usage);
+#endif
+}
@@ -0,0 +1,40 @@
+#ifndef RUNSTATS_H
+#define RUNSTATS_H
+
+#include <QString>
+#include <QStringList>
+
+struct rusage;
+
+// Resource usage of a finished program, as reported by the measuring wrapper
+struct RunStats {
+    bool valid = false;
+    int exitCode = 0;
+    int signal = 0;
+    double wallMs = 0;
+    double userMs = 0;
+    double sysMs = 0;
+    qint64 maxRssKb = 0;
+    qint64 minorFaults = 0;
+    qint64 majorFaults = 0;
+    qint64 voluntarySwitches = 0;
+    qint64 involuntarySwitches = 0;
+
+    static RunStats load(const QString &path);
+    QString summary() const;
+};
+
+// Runs user programs through "CodeIDE --measure", which forks the program,
+// waits for it with wait4() and writes its RunStats to a file. The wrapper
+// passes stdin/stdout/stderr through untouched, so the timing covers only
+// the program itself and not the IDE reading its output.
+class MeasuredRun {
+public:
+    static void wrap(QString &program, QStringList &arguments, const QString &statsFile);
+    static bool isWrapperInvocation(int argc, char *argv[]);
+    static int exec(int argc, char *argv[]);
+    // Writes the stats file for a child reaped with wait4()
+    static void writeStats(const char *statsFile, int status, double wallMs, const struct rusage &usage);
+};
+
+#endif // RUNSTATS_H
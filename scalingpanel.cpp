@@ -0,0 +1,259 @@
+#include "scalingpanel.h"
+#include "benchmarkrunner.h"
+#include "plotwidget.h"
+#include <QComboBox>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QLineEdit>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QSplitter>
+#include <QTableWidget>
+#include <QThread>
+#include <QVBoxLayout>
+
+// Tag of the discarded warm-up run
+static const int warmupTag = 0;
+
+ScalingPanel::ScalingPanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+
+    methodCombo = new QComboBox();
+    methodCombo->addItems({"Ortam değişkeni", "Argüman"});
+    connect(methodCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &ScalingPanel::onMethodChanged);
+
+    variableEdit = new QLineEdit("OMP_NUM_THREADS");
+    variableEdit->setMaximumWidth(180);
+
+    flagsEdit = new QLineEdit("-O2 -fopenmp -pthread");
+    flagsEdit->setToolTip("C/C++ için derleyici bayrakları");
+    flagsEdit->setMaximumWidth(200);
+
+    maxThreadsSpin = new QSpinBox();
+    maxThreadsSpin->setRange(1, 1024);
+    maxThreadsSpin->setValue(qMax(1, QThread::idealThreadCount()));
+    maxThreadsSpin->setPrefix("en fazla ");
+
+    repeatSpin = new QSpinBox();
+    repeatSpin->setRange(1, 50);
+    repeatSpin->setValue(5);
+    repeatSpin->setSuffix(" tekrar");
+
+    startButton = new QPushButton("▶ Ölçeklemeyi Ölç");
+    connect(startButton, &QPushButton::clicked, this, [this]() {
+        if (!isRunning())
+            emit runRequested();
+    });
+    stopButton = new QPushButton("■ Durdur");
+    stopButton->setEnabled(false);
+
+    bar->addWidget(methodCombo);
+    bar->addWidget(variableEdit);
+    bar->addWidget(flagsEdit);
+    bar->addWidget(maxThreadsSpin);
+    bar->addWidget(repeatSpin);
+    bar->addWidget(startButton);
+    bar->addWidget(stopButton);
+    bar->addStretch();
+
+    statusLabel = new QLabel("Hazır");
+    statusLabel->setStyleSheet("QLabel { color: #cccccc; }");
+
+    table = new QTableWidget(0, 5);
+    table->setHorizontalHeaderLabels({"İş parçacığı", "Medyan (ms)", "Hızlanma", "Verim %",
+                                      "Amdahl tahmini"});
+    table->horizontalHeader()->setStretchLastSection(true);
+    table->verticalHeader()->setVisible(false);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                         "gridline-color: #454545; border: none; }"
+                         "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                         "border: none; padding: 3px; }");
+
+    plot = new PlotWidget();
+    plot->setTitle("Hızlanma");
+    plot->setAxisLabels("İş parçacığı", "Hızlanma (x)");
+
+    QSplitter *splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(table);
+    splitter->addWidget(plot);
+    splitter->setSizes({500, 600});
+
+    layout->addLayout(bar);
+    layout->addWidget(statusLabel);
+    layout->addWidget(splitter);
+
+    runner = new BenchmarkRunner(this);
+    connect(runner, &BenchmarkRunner::jobFinished, this, &ScalingPanel::onJobFinished);
+    connect(runner, &BenchmarkRunner::allFinished, this, &ScalingPanel::onAllFinished);
+    connect(runner, &BenchmarkRunner::progress, this, [this](int done, int total) {
+        statusLabel->setText(QString("Ölçülüyor: %1/%2").arg(done).arg(total));
+    });
+    connect(stopButton, &QPushButton::clicked, runner, &BenchmarkRunner::cancel);
+}
+
+void ScalingPanel::onMethodChanged() {
+    if (methodCombo->currentText() == "Argüman") {
+        variableEdit->setText("{n}");
+        variableEdit->setToolTip("Programa verilecek argümanlar, {n} iş parçacığı sayısıyla değişir");
+    } else {
+        variableEdit->setText("OMP_NUM_THREADS");
+        variableEdit->setToolTip("İş parçacığı sayısını alacak ortam değişkeni");
+    }
+}
+
+QStringList ScalingPanel::buildFlags() const {
+    return BuildPipeline::splitFlags(flagsEdit->text());
+}
+
+bool ScalingPanel::isRunning() const {
+    return runner->isRunning();
+}
+
+void ScalingPanel::showError(const QString &message) {
+    statusLabel->setText(message);
+}
+
+QVector<int> ScalingPanel::threadSteps() const {
+    // Every count up to 16, then powers of two, always ending at the maximum
+    int maximum = maxThreadsSpin->value();
+    QVector<int> steps;
+    for (int n = 1; n <= maximum; n = n < 16 ? n + 1 : n * 2)
+        steps.append(n);
+    if (steps.last() != maximum)
+        steps.append(maximum);
+    return steps;
+}
+
+void ScalingPanel::start(const RunTarget &target, const QString &inputFile, const QString &runDir) {
+    if (isRunning())
+        return;
+
+    times.clear();
+    failed = false;
+    table->setRowCount(0);
+    plot->clear();
+
+    runner->reset(runDir);
+    bool useEnvironment = methodCombo->currentText() != "Argüman";
+    const QVector<int> steps = threadSteps();
+
+    auto jobFor = [&](int threads) {
+        BenchmarkJob job;
+        job.target = target;
+        job.inputFile = inputFile;
+        job.tag = threads;
+        if (useEnvironment) {
+            job.environment = QProcessEnvironment::systemEnvironment();
+            job.environment.insert(variableEdit->text().trimmed(), QString::number(threads));
+        } else {
+            QString arguments = variableEdit->text();
+            arguments.replace("{n}", QString::number(threads));
+            job.arguments = BuildPipeline::splitFlags(arguments);
+        }
+        return job;
+    };
+
+    // Warm caches and the page cache once before anything is measured
+    BenchmarkJob warmup = jobFor(1);
+    warmup.tag = warmupTag;
+    runner->enqueue(warmup);
+
+    for (int threads : steps) {
+        for (int i = 0; i < repeatSpin->value(); ++i)
+            runner->enqueue(jobFor(threads));
+    }
+
+    startButton->setEnabled(false);
+    stopButton->setEnabled(true);
+    runner->start();
+}
+
+void ScalingPanel::onJobFinished(int index, const RunStats &stats) {
+    int threads = runner->job(index).tag;
+    if (threads == warmupTag)
+        return;
+    if (!stats.valid || stats.exitCode != 0 || stats.signal != 0) {
+        failed = true;
+        showError(QString("Hata: %1 iş parçacığıyla çalıştırma başarısız (%2)")
+                      .arg(threads).arg(stats.summary()));
+        runner->cancel();
+        return;
+    }
+    times[threads].append(stats.wallMs);
+}
+
+double ScalingPanel::amdahlSerialFraction(const QMap<int, double> &medians) {
+    // T(n)/T(1) = f + (1 - f)/n  =>  T(n)/T(1) - 1/n = f * (1 - 1/n), least squares for f
+    double t1 = medians.value(1);
+    if (t1 <= 0)
+        return 0;
+    double sxy = 0, sxx = 0;
+    for (auto it = medians.cbegin(); it != medians.cend(); ++it) {
+        if (it.key() <= 1)
+            continue;
+        double x = 1.0 - 1.0 / it.key();
+        double y = it.value() / t1 - 1.0 / it.key();
+        sxy += x * y;
+        sxx += x * x;
+    }
+    return sxx > 0 ? qBound(0.0, sxy / sxx, 1.0) : 0;
+}
+
+void ScalingPanel::onAllFinished() {
+    startButton->setEnabled(true);
+    stopButton->setEnabled(false);
+    if (failed || times.isEmpty()) {
+        if (!failed)
+            statusLabel->setText("Durduruldu");
+        return;
+    }
+
+    QMap<int, double> medians;
+    for (auto it = times.cbegin(); it != times.cend(); ++it)
+        medians[it.key()] = BenchmarkRunner::median(it.value());
+
+    double t1 = medians.value(1, medians.first());
+    double serial = amdahlSerialFraction(medians);
+
+    QVector<QPointF> measured, ideal, amdahl;
+    double bestSpeedup = 0;
+    table->setRowCount(medians.size());
+    int row = 0;
+    for (auto it = medians.cbegin(); it != medians.cend(); ++it, ++row) {
+        int threads = it.key();
+        double speedup = it.value() > 0 ? t1 / it.value() : 0;
+        double predicted = 1.0 / (serial + (1.0 - serial) / threads);
+
+        bestSpeedup = qMax(bestSpeedup, speedup);
+        measured.append(QPointF(threads, speedup));
+        ideal.append(QPointF(threads, threads));
+        amdahl.append(QPointF(threads, predicted));
+
+        QStringList values;
+        values << QString::number(threads)
+               << QString::number(it.value(), 'f', 2)
+               << QString::number(speedup, 'f', 2) + "x"
+               << QString::number(speedup / threads * 100.0, 'f', 0)
+               << QString::number(predicted, 'f', 2) + "x";
+        for (int column = 0; column < values.size(); ++column)
+            table->setItem(row, column, new QTableWidgetItem(values[column]));
+    }
+
+    plot->clear();
+    plot->setPoints(plot->addSeries("Ölçülen", QColor(86, 156, 214)), measured);
+    plot->setPoints(plot->addSeries("İdeal", QColor(128, 128, 128), true), ideal);
+    plot->setPoints(plot->addSeries("Amdahl", QColor(206, 145, 120), true), amdahl);
+
+    QString limit = serial > 0 ? QString::number(1.0 / serial, 'f', 1) + "x" : "sınırsız";
+    statusLabel->setText(QString("Seri kesir (Amdahl): %1% | teorik üst sınır: %2 | "
+                                 "en iyi hızlanma: %3x")
+                             .arg(serial * 100.0, 0, 'f', 1)
+                             .arg(limit)
+                             .arg(bestSpeedup, 0, 'f', 2));
+}
@@ -0,0 +1,60 @@
+#ifndef SCALINGPANEL_H
+#define SCALINGPANEL_H
+
+#include <QWidget>
+#include <QMap>
+#include <QVector>
+#include "buildpipeline.h"
+#include "runstats.h"
+
+class BenchmarkRunner;
+class PlotWidget;
+class QComboBox;
+class QLineEdit;
+class QSpinBox;
+class QPushButton;
+class QLabel;
+class QTableWidget;
+
+// Runs one binary at 1..N threads and reports speedup, efficiency and an
+// Amdahl's law estimate of the serial fraction
+class ScalingPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit ScalingPanel(QWidget *parent = nullptr);
+
+    QStringList buildFlags() const;
+    void start(const RunTarget &target, const QString &inputFile, const QString &runDir);
+    void showError(const QString &message);
+    bool isRunning() const;
+
+signals:
+    void runRequested();
+
+private slots:
+    void onMethodChanged();
+    void onJobFinished(int index, const RunStats &stats);
+    void onAllFinished();
+
+private:
+    QVector<int> threadSteps() const;
+    static double amdahlSerialFraction(const QMap<int, double> &medians);
+
+    QComboBox *methodCombo;
+    QLineEdit *variableEdit;
+    QLineEdit *flagsEdit;
+    QSpinBox *maxThreadsSpin;
+    QSpinBox *repeatSpin;
+    QPushButton *startButton;
+    QPushButton *stopButton;
+    QLabel *statusLabel;
+    QTableWidget *table;
+    PlotWidget *plot;
+
+    BenchmarkRunner *runner;
+    QMap<int, QVector<double>> times;
+    bool failed = false;
+};
+
+#endif // SCALINGPANEL_H
@@ -0,0 +1,267 @@
+#include "stresspanel.h"
+#include "codeeditor.h"
+#include "syntaxhighlighter.h"
+#include "testpanel.h"
+#include <QComboBox>
+#include <QDir>
+#include <QFile>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QPlainTextEdit>
+#include <QProcess>
+#include <QPushButton>
+#include <QSplitter>
+#include <QThread>
+#include <QVBoxLayout>
+
+// A single generator/brute/solution run may not take longer than this
+static const int stepTimeoutMs = 10000;
+
+static QString readFile(const QString &path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return QString();
+    return QString::fromUtf8(file.readAll());
+}
+
+StressPanel::StressPanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+    const QStringList languages = {"C++", "C", "Python", "JavaScript"};
+
+    generatorLangCombo = new QComboBox();
+    generatorLangCombo->addItems(languages);
+    generatorLangCombo->setCurrentText("Python");
+    bruteLangCombo = new QComboBox();
+    bruteLangCombo->addItems(languages);
+
+    startButton = new QPushButton("▶ Stres Testini Başlat");
+    connect(startButton, &QPushButton::clicked, this, [this]() {
+        if (!isRunning())
+            emit runRequested();
+    });
+    stopButton = new QPushButton("■ Durdur");
+    stopButton->setEnabled(false);
+    connect(stopButton, &QPushButton::clicked, this, &StressPanel::stop);
+
+    throughputLabel = new QLabel("Hazır");
+    throughputLabel->setStyleSheet("QLabel { color: #cccccc; }");
+
+    QLabel *generatorLabel = new QLabel("Üreteç:");
+    QLabel *bruteLabel = new QLabel("Doğru çözüm:");
+    generatorLabel->setStyleSheet("QLabel { color: #cccccc; }");
+    bruteLabel->setStyleSheet("QLabel { color: #cccccc; }");
+
+    bar->addWidget(generatorLabel);
+    bar->addWidget(generatorLangCombo);
+    bar->addWidget(bruteLabel);
+    bar->addWidget(bruteLangCombo);
+    bar->addWidget(startButton);
+    bar->addWidget(stopButton);
+    bar->addStretch();
+    bar->addWidget(throughputLabel);
+
+    generatorEdit = new CodeEditor();
+    generatorEdit->setPlaceholderText("Üreteç: tohum (seed) ilk argüman olarak verilir, "
+                                      "girdiyi stdout'a yazın...");
+    generatorHighlighter = new SyntaxHighlighter(generatorEdit->document());
+    generatorHighlighter->setLanguage(generatorLangCombo->currentText());
+
+    bruteEdit = new CodeEditor();
+    bruteEdit->setPlaceholderText("Doğru (brute force) çözüm: girdiyi stdin'den okur...");
+    bruteHighlighter = new SyntaxHighlighter(bruteEdit->document());
+    bruteHighlighter->setLanguage(bruteLangCombo->currentText());
+
+    connect(generatorLangCombo, &QComboBox::currentTextChanged,
+            generatorHighlighter, &SyntaxHighlighter::setLanguage);
+    connect(bruteLangCombo, &QComboBox::currentTextChanged,
+            bruteHighlighter, &SyntaxHighlighter::setLanguage);
+
+    resultEdit = new QPlainTextEdit();
+    resultEdit->setReadOnly(true);
+    resultEdit->setFont(QFont("Consolas", 10));
+    resultEdit->setPlaceholderText("İlk uyuşmazlık burada gösterilir");
+    resultEdit->setStyleSheet("QPlainTextEdit { background-color: #1e1e1e; color: #d4d4d4; "
+                              "border: 1px solid #454545; }");
+
+    QSplitter *splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(generatorEdit);
+    splitter->addWidget(bruteEdit);
+    splitter->addWidget(resultEdit);
+
+    layout->addLayout(bar);
+    layout->addWidget(splitter);
+
+    throughputTimer.setInterval(500);
+    connect(&throughputTimer, &QTimer::timeout, this, &StressPanel::updateThroughput);
+}
+
+QString StressPanel::generatorCode() const {
+    return generatorEdit->toPlainText();
+}
+
+QString StressPanel::generatorLanguage() const {
+    return generatorLangCombo->currentText();
+}
+
+QString StressPanel::bruteCode() const {
+    return bruteEdit->toPlainText();
+}
+
+QString StressPanel::bruteLanguage() const {
+    return bruteLangCombo->currentText();
+}
+
+void StressPanel::showError(const QString &message) {
+    resultEdit->setPlainText(message);
+    throughputLabel->setText("Hata");
+}
+
+void StressPanel::start(const RunTarget &generatorTarget, const RunTarget &bruteTarget,
+                        const RunTarget &solutionTarget, const QString &directory) {
+    if (isRunning())
+        return;
+
+    generator = generatorTarget;
+    brute = bruteTarget;
+    solution = solutionTarget;
+    runDir = directory;
+    running = true;
+    nextSeed = 1;
+    iterations = 0;
+    resultEdit->clear();
+
+    startButton->setEnabled(false);
+    stopButton->setEnabled(true);
+    elapsed.start();
+    throughputTimer.start();
+
+    int workers = qMax(1, QThread::idealThreadCount());
+    activeWorkers = workers;
+    for (int worker = 0; worker < workers; ++worker) {
+        QDir().mkpath(workerDir(worker));
+        startIteration(worker);
+    }
+}
+
+void StressPanel::stop() {
+    // Workers notice this after their current step and wind down
+    running = false;
+}
+
+QString StressPanel::workerDir(int worker) const {
+    return QDir(runDir).filePath(QString("worker-%1").arg(worker));
+}
+
+void StressPanel::startIteration(int worker) {
+    if (!running) {
+        workerFinished();
+        return;
+    }
+
+    qint64 seed = nextSeed++;
+    QString dir = workerDir(worker);
+    QString input = dir + "/input.txt";
+    QString expected = dir + "/expected.txt";
+    QString actual = dir + "/actual.txt";
+    QString errors = dir + "/stderr.txt";
+
+    runStep(generator, {QString::number(seed)}, QString(), input, errors,
+            [this, worker, seed, dir, input, expected, actual, errors](bool ok) {
+        if (!running) { workerFinished(); return; }
+        if (!ok) { reportFailure("Üreteç hatası", seed, dir); workerFinished(); return; }
+
+        runStep(brute, QStringList(), input, expected, errors,
+                [this, worker, seed, dir, input, expected, actual, errors](bool ok) {
+            if (!running) { workerFinished(); return; }
+            if (!ok) { reportFailure("Doğru çözüm hatası", seed, dir); workerFinished(); return; }
+
+            runStep(solution, QStringList(), input, actual, errors,
+                    [this, worker, seed, dir, expected, actual](bool ok) {
+                if (!running) { workerFinished(); return; }
+                if (!ok) { reportFailure("Çözüm çalışma hatası", seed, dir); workerFinished(); return; }
+
+                if (TestPanel::normalized(readFile(expected)) != TestPanel::normalized(readFile(actual))) {
+                    reportFailure("Çıktılar farklı", seed, dir);
+                    workerFinished();
+                    return;
+                }
+                ++iterations;
+                startIteration(worker);
+            });
+        });
+    });
+}
+
+void StressPanel::runStep(const RunTarget &target, const QStringList &arguments,
+                          const QString &inputFile, const QString &outputFile,
+                          const QString &errorFile, StepCallback done) {
+    QProcess *process = new QProcess(this);
+    process->setStandardInputFile(inputFile.isEmpty() ? QProcess::nullDevice() : inputFile);
+    process->setStandardOutputFile(outputFile);
+    process->setStandardErrorFile(errorFile);
+
+    QTimer *timeout = new QTimer(process);
+    timeout->setSingleShot(true);
+    connect(timeout, &QTimer::timeout, process, &QProcess::kill);
+
+    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            [process, done](int exitCode, QProcess::ExitStatus exitStatus) {
+        process->deleteLater();
+        done(exitStatus == QProcess::NormalExit && exitCode == 0);
+    });
+    connect(process, &QProcess::errorOccurred, [process, done](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart)
+            return;
+        process->deleteLater();
+        done(false);
+    });
+
+    process->start(target.program, target.arguments + arguments);
+    timeout->start(stepTimeoutMs);
+}
+
+void StressPanel::reportFailure(const QString &reason, qint64 seed, const QString &dir) {
+    // Only the first failure is reported, the other workers just stop
+    if (!running)
+        return;
+    running = false;
+
+    QString report = QString("✗ %1 (tohum: %2, %3 başarılı yineleme)\n\n").arg(reason).arg(seed).arg(iterations);
+    report += "=== Girdi ===\n" + readFile(dir + "/input.txt") + "\n";
+    report += "=== Beklenen (doğru çözüm) ===\n" + readFile(dir + "/expected.txt") + "\n";
+    report += "=== Alınan (çözüm) ===\n" + readFile(dir + "/actual.txt") + "\n";
+
+    QString diff = TestPanel::lineDiff(readFile(dir + "/expected.txt"), readFile(dir + "/actual.txt"));
+    if (!diff.isEmpty())
+        report += "=== Fark ===\n" + diff;
+
+    QString errors = readFile(dir + "/stderr.txt");
+    if (!errors.isEmpty())
+        report += "=== stderr ===\n" + errors;
+
+    resultEdit->setPlainText(report);
+}
+
+void StressPanel::workerFinished() {
+    if (--activeWorkers > 0)
+        return;
+
+    throughputTimer.stop();
+    updateThroughput();
+    startButton->setEnabled(true);
+    stopButton->setEnabled(false);
+    if (resultEdit->toPlainText().isEmpty())
+        resultEdit->setPlainText(QString("Durduruldu: %1 yinelemede uyuşmazlık bulunmadı").arg(iterations));
+}
+
+void StressPanel::updateThroughput() {
+    double seconds = elapsed.elapsed() / 1000.0;
+    double rate = seconds > 0 ? iterations / seconds : 0;
+    throughputLabel->setText(QString("Yineleme: %1 | %2 yineleme/sn | %3 çekirdek")
+                                 .arg(iterations)
+                                 .arg(rate, 0, 'f', 1)
+                                 .arg(QThread::idealThreadCount()));
+}
@@ -0,0 +1,77 @@
+#ifndef STRESSPANEL_H
+#define STRESSPANEL_H
+
+#include <QWidget>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <functional>
+#include "buildpipeline.h"
+
+class CodeEditor;
+class SyntaxHighlighter;
+class QComboBox;
+class QPushButton;
+class QLabel;
+class QPlainTextEdit;
+
+// Randomized stress testing: generator(seed) -> brute force and solution,
+// one loop per core until the outputs differ
+class StressPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit StressPanel(QWidget *parent = nullptr);
+
+    QString generatorCode() const;
+    QString generatorLanguage() const;
+    QString bruteCode() const;
+    QString bruteLanguage() const;
+
+    void start(const RunTarget &generator, const RunTarget &brute, const RunTarget &solution,
+               const QString &runDir);
+    void showError(const QString &message);
+    bool isRunning() const { return activeWorkers > 0; }
+
+signals:
+    void runRequested();
+
+public slots:
+    void stop();
+
+private slots:
+    void updateThroughput();
+
+private:
+    using StepCallback = std::function<void(bool ok)>;
+
+    void startIteration(int worker);
+    void runStep(const RunTarget &target, const QStringList &arguments, const QString &inputFile,
+                 const QString &outputFile, const QString &errorFile, StepCallback done);
+    void reportFailure(const QString &reason, qint64 seed, const QString &dir);
+    void workerFinished();
+    QString workerDir(int worker) const;
+
+    CodeEditor *generatorEdit;
+    CodeEditor *bruteEdit;
+    SyntaxHighlighter *generatorHighlighter;
+    SyntaxHighlighter *bruteHighlighter;
+    QComboBox *generatorLangCombo;
+    QComboBox *bruteLangCombo;
+    QPushButton *startButton;
+    QPushButton *stopButton;
+    QLabel *throughputLabel;
+    QPlainTextEdit *resultEdit;
+
+    RunTarget generator;
+    RunTarget brute;
+    RunTarget solution;
+    QString runDir;
+    bool running = false;
+    int activeWorkers = 0;
+    qint64 nextSeed = 1;
+    qint64 iterations = 0;
+    QElapsedTimer elapsed;
+    QTimer throughputTimer;
+};
+
+#endif // STRESSPANEL_H
@@ -0,0 +1,54 @@
+#include "symbolizer.h"
+#include "buildpipeline.h"
+#include <QFileInfo>
+#include <QRegularExpression>
+#include <QStringList>
+
+void Symbolizer::resolve(BuildPipeline *pipeline, const QString &program, const QList<quint64> &addresses,
+                         Callback done) {
+    if (addresses.isEmpty()) {
+        done(QHash<quint64, QVector<SourceLocation>>());
+        return;
+    }
+
+    QStringList arguments;
+    arguments << "-a" << "-f" << "-C" << "-i" << "-e" << program;
+    for (quint64 address : addresses)
+        arguments << "0x" + QString::number(address, 16);
+
+    pipeline->runStep("addr2line", arguments, [done](bool ok, const QString &output) {
+        done(ok ? parse(output) : QHash<quint64, QVector<SourceLocation>>());
+    });
+}
+
+QHash<quint64, QVector<SourceLocation>> Symbolizer::parse(const QString &output) {
+    // With -a every address is followed by its inline chain, innermost first:
+    // 0x10d5 / std::sin(int) / cmath:438 / work(int) / main.cpp:3 (discriminator 2) / ...
+    static const QRegularExpression addressRe(R"(^0x([0-9a-f]+)$)");
+    static const QRegularExpression lineRe(R"(^(.*):(\d+))");
+
+    QHash<quint64, QVector<SourceLocation>> locations;
+    const QStringList lines = output.split('\n');
+    bool haveAddress = false;
+    quint64 address = 0;
+    for (int i = 0; i < lines.size(); ++i) {
+        QRegularExpressionMatch match = addressRe.match(lines[i].trimmed());
+        if (match.hasMatch()) {
+            address = match.captured(1).toULongLong(nullptr, 16);
+            haveAddress = true;
+            continue;
+        }
+        if (!haveAddress || i + 1 >= lines.size())
+            continue;
+
+        SourceLocation location;
+        location.function = lines[i].trimmed();
+        QRegularExpressionMatch position = lineRe.match(lines[++i]);
+        if (position.hasMatch()) {
+            location.file = QFileInfo(position.captured(1)).fileName();
+            location.line = position.captured(2).toInt();
+        }
+        locations[address].append(location);
+    }
+    return locations;
+}
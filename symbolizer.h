@@ -0,0 +1,29 @@
+#ifndef SYMBOLIZER_H
+#define SYMBOLIZER_H
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QVector>
+#include <functional>
+
+class BuildPipeline;
+
+struct SourceLocation {
+    QString function;
+    QString file;       // file name only
+    int line = 0;       // 0 when unknown
+};
+
+// Maps link-time addresses of a -g binary to source with addr2line. Each
+// address yields its inline chain, innermost function first.
+class Symbolizer {
+public:
+    using Callback = std::function<void(const QHash<quint64, QVector<SourceLocation>> &locations)>;
+
+    static void resolve(BuildPipeline *pipeline, const QString &program, const QList<quint64> &addresses,
+                        Callback done);
+    static QHash<quint64, QVector<SourceLocation>> parse(const QString &output);
+};
+
+#endif // SYMBOLIZER_H
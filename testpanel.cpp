@@ -0,0 +1,370 @@
+#include "testpanel.h"
+#include <QDir>
+#include <QFile>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPlainTextEdit>
+#include <QProcess>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QSplitter>
+#include <QTableWidget>
+#include <QThread>
+#include <QTimer>
+#include <QVBoxLayout>
+
+static QPlainTextEdit *createCaseEditor(const QString &placeholder, bool readOnly) {
+    QPlainTextEdit *edit = new QPlainTextEdit();
+    edit->setPlaceholderText(placeholder);
+    edit->setReadOnly(readOnly);
+    edit->setFont(QFont("Consolas", 10));
+    edit->setStyleSheet("QPlainTextEdit { background-color: #1e1e1e; color: #d4d4d4; "
+                        "border: 1px solid #454545; }");
+    return edit;
+}
+
+static QString readFile(const QString &path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return QString();
+    return QString::fromUtf8(file.readAll());
+}
+
+TestPanel::TestPanel(QWidget *parent) : QWidget(parent) {
+    QHBoxLayout *layout = new QHBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QWidget *left = new QWidget();
+    QVBoxLayout *leftLayout = new QVBoxLayout(left);
+    leftLayout->setContentsMargins(0, 0, 0, 0);
+
+    QHBoxLayout *buttons = new QHBoxLayout();
+    QPushButton *addButton = new QPushButton("+ Ekle");
+    connect(addButton, &QPushButton::clicked, this, &TestPanel::addCase);
+    QPushButton *removeButton = new QPushButton("- Sil");
+    connect(removeButton, &QPushButton::clicked, this, &TestPanel::removeCase);
+    QPushButton *loadButton = new QPushButton("📂 Klasörden Yükle");
+    loadButton->setToolTip("Klasördeki *.in dosyalarını ve aynı adlı *.out/*.ans dosyalarını yükler");
+    connect(loadButton, &QPushButton::clicked, this, &TestPanel::loadFolder);
+
+    timeoutSpin = new QSpinBox();
+    timeoutSpin->setRange(1, 600);
+    timeoutSpin->setValue(10);
+    timeoutSpin->setSuffix(" sn");
+    timeoutSpin->setToolTip("Test başına zaman sınırı");
+
+    runButton = new QPushButton("▶ Testleri Çalıştır");
+    connect(runButton, &QPushButton::clicked, this, [this]() {
+        if (!isRunning() && !cases.isEmpty())
+            emit runRequested();
+    });
+
+    buttons->addWidget(addButton);
+    buttons->addWidget(removeButton);
+    buttons->addWidget(loadButton);
+    buttons->addStretch();
+    buttons->addWidget(timeoutSpin);
+    buttons->addWidget(runButton);
+
+    table = new QTableWidget(0, 4);
+    table->setHorizontalHeaderLabels({"#", "Durum", "Süre (ms)", "Bellek (KB)"});
+    table->horizontalHeader()->setStretchLastSection(true);
+    table->verticalHeader()->setVisible(false);
+    table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table->setSelectionMode(QAbstractItemView::SingleSelection);
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                         "gridline-color: #454545; border: none; }"
+                         "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                         "border: none; padding: 3px; }");
+    connect(table, &QTableWidget::itemSelectionChanged, this, &TestPanel::onCurrentCaseChanged);
+
+    verdictLabel = new QLabel("Test yok");
+    verdictLabel->setStyleSheet("QLabel { color: #cccccc; }");
+
+    leftLayout->addLayout(buttons);
+    leftLayout->addWidget(table);
+    leftLayout->addWidget(verdictLabel);
+
+    inputEdit = createCaseEditor("Girdi", false);
+    expectedEdit = createCaseEditor("Beklenen çıktı", false);
+    actualEdit = createCaseEditor("Alınan çıktı ve fark", true);
+    connect(inputEdit, &QPlainTextEdit::textChanged, this, &TestPanel::onCaseEdited);
+    connect(expectedEdit, &QPlainTextEdit::textChanged, this, &TestPanel::onCaseEdited);
+
+    QSplitter *editors = new QSplitter(Qt::Horizontal);
+    editors->addWidget(inputEdit);
+    editors->addWidget(expectedEdit);
+    editors->addWidget(actualEdit);
+
+    QSplitter *splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(left);
+    splitter->addWidget(editors);
+    splitter->setSizes({400, 800});
+    layout->addWidget(splitter);
+}
+
+void TestPanel::addCase() {
+    TestCase test;
+    test.status = "Yeni";
+    cases.append(test);
+    table->setRowCount(cases.size());
+    updateRow(cases.size() - 1);
+    table->selectRow(cases.size() - 1);
+}
+
+void TestPanel::removeCase() {
+    int row = table->currentRow();
+    if (row < 0 || row >= cases.size() || isRunning())
+        return;
+    cases.removeAt(row);
+    table->removeRow(row);
+    for (int i = row; i < cases.size(); ++i)
+        updateRow(i);
+    onCurrentCaseChanged();
+}
+
+void TestPanel::loadFolder() {
+    QString dirName = QFileDialog::getExistingDirectory(this, "Test Klasörü Seç");
+    if (dirName.isEmpty() || isRunning())
+        return;
+
+    QDir dir(dirName);
+    const QStringList inputs = dir.entryList({"*.in"}, QDir::Files, QDir::Name);
+    for (const QString &name : inputs) {
+        QString base = QFileInfo(name).completeBaseName();
+        TestCase test;
+        test.status = "Yeni";
+        test.input = readFile(dir.filePath(name));
+        if (dir.exists(base + ".out"))
+            test.expected = readFile(dir.filePath(base + ".out"));
+        else
+            test.expected = readFile(dir.filePath(base + ".ans"));
+        cases.append(test);
+    }
+
+    table->setRowCount(cases.size());
+    for (int i = 0; i < cases.size(); ++i)
+        updateRow(i);
+    verdictLabel->setText(QString("%1 test yüklendi").arg(inputs.size()));
+}
+
+void TestPanel::onCurrentCaseChanged() {
+    int row = table->currentRow();
+    updatingEditors = true;
+    if (row >= 0 && row < cases.size()) {
+        const TestCase &test = cases[row];
+        inputEdit->setPlainText(test.input);
+        expectedEdit->setPlainText(test.expected);
+        QString actual = test.actual;
+        if (!test.diff.isEmpty())
+            actual += "\n--- Fark ---\n" + test.diff;
+        actualEdit->setPlainText(actual);
+    } else {
+        inputEdit->clear();
+        expectedEdit->clear();
+        actualEdit->clear();
+    }
+    updatingEditors = false;
+}
+
+void TestPanel::onCaseEdited() {
+    int row = table->currentRow();
+    if (updatingEditors || row < 0 || row >= cases.size())
+        return;
+    cases[row].input = inputEdit->toPlainText();
+    cases[row].expected = expectedEdit->toPlainText();
+}
+
+void TestPanel::runAll(const RunTarget &runTarget, const QString &directory) {
+    if (isRunning())
+        return;
+    // Nothing would finish to enable the button again
+    if (cases.isEmpty()) {
+        verdictLabel->setText("Test yok: önce test ekleyin veya klasör yükleyin");
+        verdictLabel->setStyleSheet("QLabel { color: #cccccc; }");
+        return;
+    }
+
+    target = runTarget;
+    runDir = directory;
+    nextCase = 0;
+    for (int i = 0; i < cases.size(); ++i) {
+        cases[i].status = "Bekliyor";
+        cases[i].actual.clear();
+        cases[i].diff.clear();
+        cases[i].stats = RunStats();
+        updateRow(i);
+    }
+
+    runButton->setEnabled(false);
+    suiteTimer.start();
+
+    // Same binary, one process per core
+    int slots = qMax(1, QThread::idealThreadCount());
+    for (int i = 0; i < slots && nextCase < cases.size(); ++i)
+        startNext();
+}
+
+void TestPanel::startNext() {
+    if (nextCase >= cases.size()) {
+        if (running == 0)
+            updateVerdict();
+        return;
+    }
+
+    int index = nextCase++;
+    ++running;
+
+    QString prefix = QDir(runDir).filePath(QString("case-%1").arg(index + 1));
+    QFile inputFile(prefix + ".in");
+    if (inputFile.open(QIODevice::WriteOnly)) {
+        inputFile.write(cases[index].input.toUtf8());
+        inputFile.close();
+    }
+
+    QProcess *process = new QProcess(this);
+    process->setStandardInputFile(prefix + ".in");
+    process->setStandardOutputFile(prefix + ".out");
+    process->setStandardErrorFile(prefix + ".err");
+
+    QTimer *timeout = new QTimer(process);
+    timeout->setSingleShot(true);
+    connect(timeout, &QTimer::timeout, process, [process]() {
+        process->setProperty("timedOut", true);
+        process->kill();
+    });
+
+    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            [this, process, index, prefix](int exitCode, QProcess::ExitStatus exitStatus) {
+        bool failed = exitStatus != QProcess::NormalExit || exitCode != 0;
+        evaluate(index, prefix, process->property("timedOut").toBool(), failed);
+        process->deleteLater();
+        --running;
+        startNext();
+    });
+    connect(process, &QProcess::errorOccurred, [this, process, index](QProcess::ProcessError error) {
+        if (error != QProcess::FailedToStart)
+            return;
+        cases[index].status = "Başlatılamadı";
+        updateRow(index);
+        process->deleteLater();
+        --running;
+        startNext();
+    });
+
+    cases[index].status = "Çalışıyor";
+    updateRow(index);
+
+    QString program = target.program;
+    QStringList arguments = target.arguments;
+    MeasuredRun::wrap(program, arguments, prefix + ".stats");
+    process->start(program, arguments);
+    timeout->start(timeoutSpin->value() * 1000);
+}
+
+void TestPanel::evaluate(int index, const QString &prefix, bool timedOut, bool failed) {
+    TestCase &test = cases[index];
+    test.stats = RunStats::load(prefix + ".stats");
+    test.actual = readFile(prefix + ".out");
+
+    if (timedOut) {
+        test.status = "Zaman aşımı";
+    } else if (failed) {
+        test.status = "Çalışma hatası";
+        test.diff = readFile(prefix + ".err");
+    } else if (normalized(test.actual) == normalized(test.expected)) {
+        test.status = "Geçti";
+    } else {
+        test.status = "Kaldı";
+        test.diff = lineDiff(test.expected, test.actual);
+    }
+
+    updateRow(index);
+    if (table->currentRow() == index)
+        onCurrentCaseChanged();
+}
+
+void TestPanel::updateRow(int index) {
+    const TestCase &test = cases[index];
+    QStringList values;
+    values << QString::number(index + 1) << test.status;
+    if (test.stats.valid)
+        values << QString::number(test.stats.wallMs, 'f', 1) << QString::number(test.stats.maxRssKb);
+    else
+        values << "-" << "-";
+
+    QColor color(212, 212, 212);
+    if (test.status == "Geçti") color = QColor(78, 201, 176);
+    else if (test.status == "Kaldı" || test.status == "Zaman aşımı" ||
+             test.status == "Çalışma hatası" || test.status == "Başlatılamadı") color = QColor(244, 71, 71);
+
+    for (int column = 0; column < values.size(); ++column) {
+        QTableWidgetItem *item = table->item(index, column);
+        if (!item) {
+            item = new QTableWidgetItem();
+            table->setItem(index, column, item);
+        }
+        item->setText(values[column]);
+        item->setForeground(color);
+    }
+}
+
+void TestPanel::updateVerdict() {
+    int passed = 0;
+    double slowest = 0;
+    qint64 peakMemory = 0;
+    for (const TestCase &test : cases) {
+        if (test.status == "Geçti") ++passed;
+        slowest = qMax(slowest, test.stats.wallMs);
+        peakMemory = qMax(peakMemory, test.stats.maxRssKb);
+    }
+
+    bool allPassed = passed == cases.size();
+    verdictLabel->setText(QString("%1 — %2/%3 geçti | toplam %4 ms | en yavaş %5 ms | en fazla bellek %6 KB")
+                              .arg(allPassed ? "KABUL" : "RED")
+                              .arg(passed)
+                              .arg(cases.size())
+                              .arg(suiteTimer.elapsed())
+                              .arg(slowest, 0, 'f', 1)
+                              .arg(peakMemory));
+    verdictLabel->setStyleSheet(allPassed ? "QLabel { color: #4ec9b0; font-weight: bold; }"
+                                          : "QLabel { color: #f44747; font-weight: bold; }");
+    runButton->setEnabled(true);
+}
+
+QString TestPanel::normalized(const QString &text) {
+    QStringList lines = text.split('\n');
+    for (QString &line : lines) {
+        while (!line.isEmpty() && line.at(line.size() - 1).isSpace())
+            line.chop(1);
+    }
+    while (!lines.isEmpty() && lines.last().isEmpty())
+        lines.removeLast();
+    return lines.join('\n');
+}
+
+QString TestPanel::lineDiff(const QString &expected, const QString &actual) {
+    static const int maxReported = 50;
+
+    QStringList expectedLines = normalized(expected).split('\n');
+    QStringList actualLines = normalized(actual).split('\n');
+    QString diff;
+    int reported = 0;
+    int count = qMax(expectedLines.size(), actualLines.size());
+    for (int i = 0; i < count; ++i) {
+        QString want = i < expectedLines.size() ? expectedLines[i] : "<yok>";
+        QString got = i < actualLines.size() ? actualLines[i] : "<yok>";
+        if (want == got)
+            continue;
+        if (++reported > maxReported) {
+            diff += "...\n";
+            break;
+        }
+        diff += QString("Satır %1:\n- %2\n+ %3\n").arg(i + 1).arg(want, got);
+    }
+    return diff;
+}
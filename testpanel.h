@@ -0,0 +1,71 @@
+#ifndef TESTPANEL_H
+#define TESTPANEL_H
+
+#include <QWidget>
+#include <QElapsedTimer>
+#include "buildpipeline.h"
+#include "runstats.h"
+
+class QTableWidget;
+class QPlainTextEdit;
+class QPushButton;
+class QLabel;
+class QSpinBox;
+
+struct TestCase {
+    QString input;
+    QString expected;
+    QString actual;
+    QString status;
+    QString diff;
+    RunStats stats;
+};
+
+// (input, expected output) pairs run in parallel against one built program
+class TestPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit TestPanel(QWidget *parent = nullptr);
+
+    void runAll(const RunTarget &target, const QString &runDir);
+    bool isRunning() const { return running > 0; }
+    bool isEmpty() const { return cases.isEmpty(); }
+
+    static QString normalized(const QString &text);
+    static QString lineDiff(const QString &expected, const QString &actual);
+
+signals:
+    void runRequested();
+
+private slots:
+    void addCase();
+    void removeCase();
+    void loadFolder();
+    void onCurrentCaseChanged();
+    void onCaseEdited();
+
+private:
+    void startNext();
+    void evaluate(int index, const QString &prefix, bool timedOut, bool failed);
+    void updateRow(int index);
+    void updateVerdict();
+
+    QList<TestCase> cases;
+    QTableWidget *table;
+    QPlainTextEdit *inputEdit;
+    QPlainTextEdit *expectedEdit;
+    QPlainTextEdit *actualEdit;
+    QPushButton *runButton;
+    QSpinBox *timeoutSpin;
+    QLabel *verdictLabel;
+
+    RunTarget target;
+    QString runDir;
+    int nextCase = 0;
+    int running = 0;
+    bool updatingEditors = false;
+    QElapsedTimer suiteTimer;
+};
+
+#endif // TESTPANEL_H
@@ -0,0 +1,364 @@
+#include "throughputpanel.h"
+#include "assemblyview.h"
+#include "buildpipeline.h"
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QHash>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QLineEdit>
+#include <QMap>
+#include <QPlainTextEdit>
+#include <QPushButton>
+#include <QRegularExpression>
+#include <QSet>
+#include <QSplitter>
+#include <QStandardPaths>
+#include <QTableWidget>
+#include <QVBoxLayout>
+#include <algorithm>
+
+ThroughputPanel::ThroughputPanel(QWidget *parent) : QWidget(parent) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(5, 5, 5, 5);
+
+    QHBoxLayout *bar = new QHBoxLayout();
+
+    flagsEdit = new QLineEdit("-O2 -march=native");
+    flagsEdit->setToolTip("Analiz edilen kodu üretirken kullanılacak derleyici bayrakları");
+    flagsEdit->setMaximumWidth(250);
+
+    startButton = new QPushButton("▶ Seçimi Analiz Et");
+    startButton->setToolTip("Editörde seçili satırların komutlarını llvm-mca ile analiz et");
+    connect(startButton, &QPushButton::clicked, this, [this]() {
+        if (!busy)
+            emit runRequested();
+    });
+
+    statusLabel = new QLabel("Editörde bir döngü seçin");
+    statusLabel->setStyleSheet("QLabel { color: #cccccc; }");
+
+    bar->addWidget(flagsEdit);
+    bar->addWidget(startButton);
+    bar->addStretch();
+    bar->addWidget(statusLabel);
+
+    summaryLabel = new QLabel();
+    summaryLabel->setStyleSheet("QLabel { color: #cccccc; }");
+    summaryLabel->setWordWrap(true);
+    summaryLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+
+    portTable = new QTableWidget(0, 2);
+    portTable->setHorizontalHeaderLabels({"Kaynak", "Döngü/iterasyon"});
+    portTable->horizontalHeader()->setStretchLastSection(true);
+    portTable->verticalHeader()->setVisible(false);
+    portTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    portTable->setStyleSheet("QTableWidget { background-color: #1e1e1e; color: #d4d4d4; "
+                             "gridline-color: #454545; border: none; }"
+                             "QHeaderView::section { background-color: #2d2d30; color: #cccccc; "
+                             "border: none; padding: 3px; }");
+
+    reportEdit = new QPlainTextEdit();
+    reportEdit->setReadOnly(true);
+    reportEdit->setLineWrapMode(QPlainTextEdit::NoWrap);
+    reportEdit->setStyleSheet("QPlainTextEdit { background-color: #1e1e1e; color: #d4d4d4; "
+                              "border: none; }");
+    reportEdit->setFont(QFont("Consolas", 10));
+
+    QSplitter *splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(portTable);
+    splitter->addWidget(reportEdit);
+    splitter->setSizes({300, 800});
+
+    layout->addLayout(bar);
+    layout->addWidget(summaryLabel);
+    layout->addWidget(splitter);
+}
+
+QString ThroughputPanel::findTool() {
+    QString tool = QStandardPaths::findExecutable("llvm-mca");
+    // Distributions often only ship versioned names
+    for (int version = 20; tool.isEmpty() && version >= 10; --version)
+        tool = QStandardPaths::findExecutable(QString("llvm-mca-%1").arg(version));
+    return tool;
+}
+
+void ThroughputPanel::showError(const QString &message) {
+    statusLabel->setText(message);
+}
+
+void ThroughputPanel::analyze(BuildPipeline *pipeline, const QString &language, const QString &code,
+                              int firstLine, int lastLine) {
+    if (busy)
+        return;
+    if (!BuildPipeline::isCompiled(language)) {
+        showError("Hata: Verim analizi yalnızca C ve C++ için kullanılabilir!");
+        return;
+    }
+    if (findTool().isEmpty()) {
+        showError("Hata: llvm-mca bulunamadı (LLVM araçlarını kurun)");
+        return;
+    }
+
+    this->firstLine = firstLine;
+    this->lastLine = lastLine;
+
+    // AT&T syntax, which llvm-mca reads by default; LTO would emit bytecode
+    QStringList flags;
+    for (const QString &flag : BuildPipeline::splitFlags(flagsEdit->text())) {
+        if (!flag.startsWith("-flto") && !flag.startsWith("-masm="))
+            flags << flag;
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(flags.join('\n').toUtf8());
+    QString dir = QDir(pipeline->rootDir()).filePath("mca-" + BuildPipeline::sourceKey(language, code) +
+                                                     QString::fromLatin1(hash.result().toHex().left(8)));
+    QString sourceName = "main" + BuildPipeline::sourceSuffix(language);
+    QString listing = dir + "/main.s";
+    QString regionFile = dir + QString("/region-%1-%2.s").arg(firstLine).arg(lastLine);
+
+    busy = true;
+    startButton->setEnabled(false);
+    summaryLabel->clear();
+    portTable->setRowCount(0);
+    reportEdit->clear();
+
+    if (QFile::exists(listing)) {
+        runMca(pipeline, listing, sourceName, regionFile);
+        return;
+    }
+
+    QDir().mkpath(dir);
+    QFile file(dir + "/" + sourceName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        busy = false;
+        startButton->setEnabled(true);
+        showError("Hata: Dosya oluşturulamadı!");
+        return;
+    }
+    file.write(code.toUtf8());
+    file.close();
+
+    statusLabel->setText("Derleniyor...");
+    QStringList arguments;
+    arguments << "-S" << "-g" << "-fno-asynchronous-unwind-tables" << file.fileName() << flags
+              << "-o" << listing;
+    pipeline->runStep(BuildPipeline::compiler(language), arguments,
+                      [this, pipeline, listing, sourceName, regionFile](bool ok, const QString &log) {
+        if (!ok) {
+            QFile::remove(listing);
+            busy = false;
+            startButton->setEnabled(true);
+            showError("✗ Derleme hatası");
+            reportEdit->setPlainText(log);
+            return;
+        }
+        runMca(pipeline, listing, sourceName, regionFile);
+    });
+}
+
+struct LoopRegion {
+    int begin = 0;          // index of the loop label in the listing
+    int end = 0;            // index of the last branch back to it
+    int selected = 0;       // instructions from the selected lines
+    bool branches = false;  // other jumps inside, so not a single block
+    bool packed = false;    // SIMD instructions, the vectorized copy
+};
+
+// Loops: a label with a jump back to it further down the
+// same function. Several back edges (continue) make one loop. A backward
+// jump over a ret or out through a jmp is block placement, not a loop.
+static QVector<LoopRegion> findLoops(const QVector<AssemblyLine> &listing, int firstLine, int lastLine) {
+    static const QRegularExpression jumpRe(R"(^j[a-z]+\s+([.\w]+)$)");
+    static const QRegularExpression packedRe(R"(^(v?p(?!ush|op)[a-z]+|v?[a-z]+p[sd]|v?movdq[au]\w*)\s)");
+    QVector<LoopRegion> loops;
+    QHash<QString, int> labels;
+    QHash<int, int> loopAt;
+    for (int i = 0; i < listing.size(); ++i) {
+        const AssemblyLine &line = listing[i];
+        if (line.label) {
+            QString name = line.text.chopped(1);
+            if (!name.startsWith('.'))
+                labels.clear();
+            labels.insert(name, i);
+            continue;
+        }
+        QRegularExpressionMatch jump = jumpRe.match(line.text);
+        if (!jump.hasMatch() || !labels.contains(jump.captured(1)))
+            continue;
+        int begin = labels.value(jump.captured(1));
+        if (!loopAt.contains(begin)) {
+            loopAt.insert(begin, loops.size());
+            loops.append(LoopRegion());
+            loops.last().begin = begin;
+        }
+        loops[loopAt.value(begin)].end = i;
+    }
+
+    QVector<LoopRegion> result;
+    for (LoopRegion loop : loops) {
+        QSet<QString> inside;
+        for (int i = loop.begin; i <= loop.end; ++i) {
+            if (listing[i].label)
+                inside.insert(listing[i].text.chopped(1));
+        }
+        bool straight = true;
+        for (int i = loop.begin; i <= loop.end && straight; ++i) {
+            const AssemblyLine &line = listing[i];
+            if (line.label)
+                continue;
+            if (line.sourceLine >= firstLine && line.sourceLine <= lastLine)
+                ++loop.selected;
+            loop.packed = loop.packed || packedRe.match(line.text).hasMatch();
+            QRegularExpressionMatch jump = jumpRe.match(line.text);
+            if (line.text.startsWith("ret") ||
+                (jump.hasMatch() && line.text.startsWith("jmp ") && !inside.contains(jump.captured(1))))
+                straight = false;
+            else if (i < loop.end && jump.hasMatch())
+                loop.branches = true;
+        }
+        if (straight)
+            result.append(loop);
+    }
+    return result;
+}
+
+void ThroughputPanel::runMca(BuildPipeline *pipeline, const QString &listing, const QString &sourceName,
+                             const QString &regionFile) {
+    // llvm-mca repeats its input as one straight-line block, which only means
+    // something for a loop body: take the innermost loop that carries the
+    // selected lines, from its label to the branch back to it. Prologue,
+    // epilogue and the other copies of the loop stay out.
+    const QVector<AssemblyLine> lines = AssemblyView::parseListing(listing, sourceName, nullptr, true);
+    QVector<LoopRegion> candidates;
+    for (const LoopRegion &loop : findLoops(lines, firstLine, lastLine)) {
+        if (loop.selected > 0)
+            candidates.append(loop);
+    }
+    QVector<LoopRegion> innermost;
+    for (const LoopRegion &loop : candidates) {
+        bool outer = std::any_of(candidates.begin(), candidates.end(), [&loop](const LoopRegion &other) {
+            return other.begin != loop.begin && other.begin >= loop.begin && other.end <= loop.end;
+        });
+        if (!outer)
+            innermost.append(loop);
+    }
+    if (innermost.isEmpty()) {
+        busy = false;
+        startButton->setEnabled(true);
+        showError(QString("Hata: %1-%2 satırları bir döngü gövdesinde değil (döngü açılmış, elenmiş ya da "
+                          "satır içi açılmış olabilir); llvm-mca yalnızca döngünün kararlı durumunu ölçer")
+                      .arg(firstLine).arg(lastLine));
+        return;
+    }
+
+    // A vectorized loop also has a scalar copy for the remainder, the SIMD
+    // body is the one that runs most of the iterations
+    auto vectorized = std::find_if(innermost.begin(), innermost.end(), [](const LoopRegion &candidate) {
+        return candidate.packed;
+    });
+    const LoopRegion loop = vectorized != innermost.end() ? *vectorized : innermost.first();
+    QString loopName = lines[loop.begin].text.chopped(1);
+    QStringList region;
+    for (int i = loop.begin; i <= loop.end; ++i) {
+        if (!lines[i].label)
+            region << "\t" + lines[i].text;
+    }
+    QString note;
+    if (loop.branches)
+        note += " | gövdede dallanma var, tüm yollar birlikte sayıldı";
+    if (innermost.size() > 1)
+        note += QString(" | %1 döngü kopyasından biri").arg(innermost.size());
+
+    QFile file(regionFile);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        busy = false;
+        startButton->setEnabled(true);
+        showError("Hata: Dosya oluşturulamadı!");
+        return;
+    }
+    file.write((region.join('\n') + '\n').toUtf8());
+    file.close();
+
+    statusLabel->setText(QString("llvm-mca: %1 komut analiz ediliyor...").arg(region.size()));
+    QStringList arguments;
+    arguments << "-bottleneck-analysis" << "-iterations=100" << regionFile;
+    pipeline->runStep(findTool(), arguments, [this, region, loopName, note](bool ok, const QString &log) {
+        busy = false;
+        startButton->setEnabled(true);
+        reportEdit->setPlainText(log);
+        if (!ok) {
+            showError("✗ llvm-mca hatası");
+            return;
+        }
+        statusLabel->setText(QString("%1-%2 satırları, %3 döngü gövdesi, %4 komut")
+                                 .arg(firstLine).arg(lastLine).arg(loopName).arg(region.size()) + note);
+        showReport(log);
+    });
+}
+
+void ThroughputPanel::showReport(const QString &report) {
+    auto value = [&report](const QString &name) {
+        QRegularExpression re("^" + QRegularExpression::escape(name) + R"(:\s+(\S+))",
+                              QRegularExpression::MultilineOption);
+        return re.match(report).captured(1);
+    };
+
+    // Resources:
+    // [0]   - SKLDivider
+    static const QRegularExpression resourceRe(R"(^\[([\d.]+)\]\s+-\s+(\S+))", QRegularExpression::MultilineOption);
+    QMap<QString, QString> names;
+    QRegularExpressionMatchIterator it = resourceRe.globalMatch(report);
+    while (it.hasNext()) {
+        QRegularExpressionMatch match = it.next();
+        names.insert(match.captured(1), match.captured(2));
+    }
+
+    // Resource pressure per iteration:
+    // [0]    [1]    [2] ...
+    //  -      -     1.00 ...
+    QStringList columns, values;
+    QStringList lines = report.split('\n');
+    int header = lines.indexOf(QRegularExpression(R"(^Resource pressure per iteration:.*)"));
+    if (header >= 0 && header + 2 < lines.size()) {
+        columns = lines[header + 1].simplified().split(' ');
+        values = lines[header + 2].simplified().split(' ');
+    }
+
+    QString bottleneck;
+    double worst = 0;
+    portTable->setRowCount(0);
+    for (int i = 0; i < columns.size() && i < values.size(); ++i) {
+        QString index = columns[i];
+        index.remove('[').remove(']');
+        double pressure = values[i] == "-" ? 0 : values[i].toDouble();
+        QString name = names.value(index, columns[i]);
+        if (pressure > worst) {
+            worst = pressure;
+            bottleneck = name;
+        }
+
+        int row = portTable->rowCount();
+        portTable->insertRow(row);
+        portTable->setItem(row, 0, new QTableWidgetItem(name));
+        QTableWidgetItem *item = new QTableWidgetItem(values[i]);
+        portTable->setItem(row, 1, item);
+    }
+    for (int row = 0; row < portTable->rowCount(); ++row) {
+        if (portTable->item(row, 0)->text() == bottleneck)
+            portTable->item(row, 1)->setForeground(QColor(244, 135, 113));
+    }
+
+    QString summary = QString("Blok verimi (RThroughput): %1 döngü | IPC: %2 | uOps/döngü: %3")
+                          .arg(value("Block RThroughput"), value("IPC"), value("uOps Per Cycle"));
+    if (!bottleneck.isEmpty())
+        summary += QString(" | en yüklü kaynak: %1 (%2 döngü/iterasyon)").arg(bottleneck).arg(worst);
+    if (report.contains("No resource or data dependency bottlenecks discovered"))
+        summary += " | darboğaz bulunmadı";
+    else if (report.contains("Cycles with backend pressure increase"))
+        summary += " | arka uç baskısı var, ayrıntılar raporda";
+    summaryLabel->setText(summary);
+}
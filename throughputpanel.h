@@ -0,0 +1,48 @@
+#ifndef THROUGHPUTPANEL_H
+#define THROUGHPUTPANEL_H
+
+#include <QWidget>
+
+class BuildPipeline;
+class QLabel;
+class QLineEdit;
+class QPlainTextEdit;
+class QPushButton;
+class QTableWidget;
+
+// Static throughput analysis of the innermost loop body generated for a
+// range of source lines, using llvm-mca with the host CPU model
+class ThroughputPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit ThroughputPanel(QWidget *parent = nullptr);
+
+    void analyze(BuildPipeline *pipeline, const QString &language, const QString &code,
+                 int firstLine, int lastLine);
+    void showError(const QString &message);
+    bool isRunning() const { return busy; }
+
+    static QString findTool();
+
+signals:
+    void runRequested();
+
+private:
+    void runMca(BuildPipeline *pipeline, const QString &listing, const QString &sourceName,
+                const QString &regionFile);
+    void showReport(const QString &report);
+
+    QLineEdit *flagsEdit;
+    QPushButton *startButton;
+    QLabel *statusLabel;
+    QLabel *summaryLabel;
+    QTableWidget *portTable;
+    QPlainTextEdit *reportEdit;
+
+    bool busy = false;
+    int firstLine = 0;
+    int lastLine = 0;
+};
+
+#endif // THROUGHPUTPANEL_H